@@ -0,0 +1,290 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/orientation/rotation_matrix.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains plain 3x3 rotation matrix helpers
+ *
+ * These functions work on raw element arrays instead of math::tMatrix
+ * and are used by the pose and orientation classes in their hot paths,
+ * e.g. to compose rigid transformations without general matrix code.
+ * The rotation matrix convention is R = Rz(yaw) * Ry(pitch) * Rx(roll),
+ * which is the same as math::Get3DRotationMatrixFromRollPitchYaw.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__orientation__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tOrientation.h" instead.
+#endif
+
+#ifndef __rrlib__localization__orientation__rotation_matrix_h__
+#define __rrlib__localization__orientation__rotation_matrix_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+namespace orientation
+{
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+//! Fill a rotation matrix from roll, pitch and yaw given in radian
+template <typename TElement>
+inline void GetRotationMatrix(TElement(&rotation)[3][3], TElement roll, TElement pitch, TElement yaw)
+{
+  const TElement sin_roll = std::sin(roll);
+  const TElement cos_roll = std::cos(roll);
+  const TElement sin_pitch = std::sin(pitch);
+  const TElement cos_pitch = std::cos(pitch);
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+
+  rotation[0][0] = cos_yaw * cos_pitch;
+  rotation[0][1] = cos_yaw * sin_pitch * sin_roll - sin_yaw * cos_roll;
+  rotation[0][2] = cos_yaw * sin_pitch * cos_roll + sin_yaw * sin_roll;
+  rotation[1][0] = sin_yaw * cos_pitch;
+  rotation[1][1] = sin_yaw * sin_pitch * sin_roll + cos_yaw * cos_roll;
+  rotation[1][2] = sin_yaw * sin_pitch * cos_roll - cos_yaw * sin_roll;
+  rotation[2][0] = -sin_pitch;
+  rotation[2][1] = cos_pitch * sin_roll;
+  rotation[2][2] = cos_pitch * cos_roll;
+}
+
+//! Multiply two rotation matrices (result = left * right)
+/*! \note result must not alias left or right
+ */
+template <typename TElement>
+inline void Multiply(TElement(&result)[3][3], const TElement(&left)[3][3], const TElement(&right)[3][3])
+{
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      result[i][j] = left[i][0] * right[0][j] + left[i][1] * right[1][j] + left[i][2] * right[2][j];
+    }
+  }
+}
+
+//! Multiply the transposed left matrix with the right one (result = left^T * right)
+/*! As left is a rotation, its transposed is its inverse.
+ * \note result must not alias left or right
+ */
+template <typename TElement>
+inline void MultiplyTransposed(TElement(&result)[3][3], const TElement(&left)[3][3], const TElement(&right)[3][3])
+{
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      result[i][j] = left[0][i] * right[0][j] + left[1][i] * right[1][j] + left[2][i] * right[2][j];
+    }
+  }
+}
+
+//! Multiply the left matrix with the transposed right one (result = left * right^T)
+/*! \note result must not alias left or right
+ */
+template <typename TElement>
+inline void MultiplyByTransposed(TElement(&result)[3][3], const TElement(&left)[3][3], const TElement(&right)[3][3])
+{
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      result[i][j] = left[i][0] * right[j][0] + left[i][1] * right[j][1] + left[i][2] * right[j][2];
+    }
+  }
+}
+
+//! Check whether a matrix is orthonormal with determinant 1
+/*! The columns must be of unit length and orthogonal to each other up to
+ * max_error, and the third column must be the cross product of the first two.
+ */
+template <typename TElement>
+inline bool IsRotationMatrix(const TElement(&rotation)[3][3], double max_error)
+{
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = i; j < 3; ++j)
+    {
+      const double dot_product = rotation[0][i] * rotation[0][j] + rotation[1][i] * rotation[1][j] + rotation[2][i] * rotation[2][j];
+      if (std::fabs(dot_product - (i == j ? 1 : 0)) > max_error)
+      {
+        return false;
+      }
+    }
+  }
+  const double determinant = rotation[0][0] * (rotation[1][1] * rotation[2][2] - rotation[2][1] * rotation[1][2]) -
+                             rotation[0][1] * (rotation[1][0] * rotation[2][2] - rotation[2][0] * rotation[1][2]) +
+                             rotation[0][2] * (rotation[1][0] * rotation[2][1] - rotation[2][0] * rotation[1][1]);
+  return std::fabs(determinant - 1) <= max_error;
+}
+
+//! Extract roll, pitch and yaw in radian from an orthonormal rotation matrix
+/*! In contrast to math::tMatrix::ExtractRollPitchYaw this does not check
+ * the matrix and always yields the solution with pitch in [-pi/2, pi/2].
+ * In gimbal lock roll is set to zero and the remaining rotation is put into yaw.
+ * Both cases are computed with the same three atan2 calls and only the
+ * arguments are selected, so there is no branch the compiler has to keep.
+ */
+template <typename TElement>
+inline void ExtractRollPitchYaw(const TElement(&rotation)[3][3], TElement &roll, TElement &pitch, TElement &yaw)
+{
+  const TElement cos_pitch = std::sqrt(rotation[0][0] * rotation[0][0] + rotation[1][0] * rotation[1][0]);
+  const bool gimbal_lock = !(cos_pitch > static_cast<TElement>(1E-6));
+  pitch = std::atan2(-rotation[2][0], cos_pitch);
+  roll = std::atan2(gimbal_lock ? 0 : rotation[2][1], gimbal_lock ? 1 : rotation[2][2]);
+  yaw = std::atan2(gimbal_lock ? -rotation[0][1] : rotation[1][0], gimbal_lock ? rotation[1][1] : rotation[0][0]);
+}
+
+//! Extract roll, pitch and yaw in radian from a number of orthonormal rotation matrices
+/*! The results are written to separate arrays, so that the loop can be
+ * vectorised when a vector math library provides atan2 and sqrt.
+ * \note The output arrays must not alias each other
+ */
+template <typename TElement>
+inline void ExtractRollPitchYaw(const TElement(*rotations)[3][3], size_t count, TElement *roll, TElement *pitch, TElement *yaw)
+{
+  for (size_t i = 0; i < count; ++i)
+  {
+    ExtractRollPitchYaw(rotations[i], roll[i], pitch[i], yaw[i]);
+  }
+}
+
+//! Fill the matrix that maps roll, pitch and yaw rates to the angular velocity in the parent frame
+/*! Useful as Jacobian of the rotation of a frame w.r.t. its Euler angles
+ * when the perturbation is expressed in the parent frame.
+ */
+template <typename TElement>
+inline void GetParentFrameAngularRateMatrix(TElement(&matrix)[3][3], TElement pitch, TElement yaw)
+{
+  const TElement sin_pitch = std::sin(pitch);
+  const TElement cos_pitch = std::cos(pitch);
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+
+  matrix[0][0] = cos_yaw * cos_pitch;
+  matrix[0][1] = -sin_yaw;
+  matrix[0][2] = 0;
+  matrix[1][0] = sin_yaw * cos_pitch;
+  matrix[1][1] = cos_yaw;
+  matrix[1][2] = 0;
+  matrix[2][0] = -sin_pitch;
+  matrix[2][1] = 0;
+  matrix[2][2] = 1;
+}
+
+//! Fill the inverse of the matrix from GetParentFrameAngularRateMatrix
+/*! \note This is singular in gimbal lock (cos(pitch) = 0)
+ */
+template <typename TElement>
+inline void GetInverseParentFrameAngularRateMatrix(TElement(&matrix)[3][3], TElement pitch, TElement yaw)
+{
+  const TElement tan_pitch = std::tan(pitch);
+  const TElement inverse_cos_pitch = 1 / std::cos(pitch);
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+
+  matrix[0][0] = cos_yaw * inverse_cos_pitch;
+  matrix[0][1] = sin_yaw * inverse_cos_pitch;
+  matrix[0][2] = 0;
+  matrix[1][0] = -sin_yaw;
+  matrix[1][1] = cos_yaw;
+  matrix[1][2] = 0;
+  matrix[2][0] = cos_yaw * tan_pitch;
+  matrix[2][1] = sin_yaw * tan_pitch;
+  matrix[2][2] = 1;
+}
+
+//! Fill the matrix that maps roll, pitch and yaw rates to the angular velocity in the local frame
+template <typename TElement>
+inline void GetLocalFrameAngularRateMatrix(TElement(&matrix)[3][3], TElement roll, TElement pitch)
+{
+  const TElement sin_roll = std::sin(roll);
+  const TElement cos_roll = std::cos(roll);
+  const TElement sin_pitch = std::sin(pitch);
+  const TElement cos_pitch = std::cos(pitch);
+
+  matrix[0][0] = 1;
+  matrix[0][1] = 0;
+  matrix[0][2] = -sin_pitch;
+  matrix[1][0] = 0;
+  matrix[1][1] = cos_roll;
+  matrix[1][2] = sin_roll * cos_pitch;
+  matrix[2][0] = 0;
+  matrix[2][1] = -sin_roll;
+  matrix[2][2] = cos_roll * cos_pitch;
+}
+
+//! Fill the inverse of the matrix from GetLocalFrameAngularRateMatrix
+/*! \note This is singular in gimbal lock (cos(pitch) = 0)
+ */
+template <typename TElement>
+inline void GetInverseLocalFrameAngularRateMatrix(TElement(&matrix)[3][3], TElement roll, TElement pitch)
+{
+  const TElement sin_roll = std::sin(roll);
+  const TElement cos_roll = std::cos(roll);
+  const TElement tan_pitch = std::tan(pitch);
+  const TElement inverse_cos_pitch = 1 / std::cos(pitch);
+
+  matrix[0][0] = 1;
+  matrix[0][1] = sin_roll * tan_pitch;
+  matrix[0][2] = cos_roll * tan_pitch;
+  matrix[1][0] = 0;
+  matrix[1][1] = cos_roll;
+  matrix[1][2] = -sin_roll;
+  matrix[2][0] = 0;
+  matrix[2][1] = sin_roll * inverse_cos_pitch;
+  matrix[2][2] = cos_roll * inverse_cos_pitch;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
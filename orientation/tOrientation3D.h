@@ -39,6 +39,7 @@
 #define __rrlib__localization__orientation__tOrientation3D_h__
 
 #include "rrlib/localization/orientation/tOrientationBase.h"
+#include "rrlib/localization/orientation/rotation_matrix.h"
 
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
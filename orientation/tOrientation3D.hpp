@@ -132,6 +132,25 @@ template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
 template <typename TMatrixElement>
 void tOrientation<3, TElement, TSIUnit, TAutoWrapPolicy>::Set(const math::tMatrix<3, 3, TMatrixElement> &matrix, double max_error, bool use_second_solution)
 {
+  TElement rotation[3][3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      rotation[i][j] = matrix[i][j];
+    }
+  }
+  // the closed form assumes an orthonormal matrix, anything else is left to the checks of the generic extraction
+  if (!use_second_solution && orientation::IsRotationMatrix(rotation, max_error))
+  {
+    TElement roll, pitch, yaw;
+    orientation::ExtractRollPitchYaw(rotation, roll, pitch, yaw);
+    this->roll = tComponent<>(roll);
+    this->pitch = tComponent<>(pitch);
+    this->yaw = tComponent<>(yaw);
+    return;
+  }
+
   math::tAngle<TElement, math::angle::Radian> roll, pitch, yaw;
   matrix.ExtractRollPitchYaw(roll, pitch, yaw, use_second_solution, max_error);
   this->roll = tComponent<>(roll);
@@ -0,0 +1,260 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/orientation/tQuaternionOrientation.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tQuaternionOrientation
+ *
+ * \b tQuaternionOrientation
+ *
+ * A three dimensional orientation that is stored as unit quaternion
+ * instead of roll, pitch and yaw. Concatenating rotations only needs
+ * 16 multiply-adds and no trigonometric functions, while the Euler
+ * angles are only computed when they are actually read.
+ *
+ * It converts implicitly from and to \ref tOrientation3D so that code
+ * can migrate gradually. Converting a tOrientation3D and back yields
+ * the same roll, pitch and yaw up to rounding as long as pitch is in
+ * [-pi/2, pi/2], which is the range every rotation can be expressed in.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__orientation__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tOrientation.h" instead.
+#endif
+
+#ifndef __rrlib__localization__orientation__tQuaternionOrientation_h__
+#define __rrlib__localization__orientation__tQuaternionOrientation_h__
+
+#include "rrlib/localization/orientation/tOrientation3D.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <iostream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A three dimensional orientation stored as unit quaternion
+/*! The quaternion q = (w, x, y, z) describes the same rotation as -q.
+ *  This class keeps w non-negative whenever it is constructed from
+ *  Euler angles or a matrix, but not after concatenation.
+ */
+template <typename TElement = double, typename TAutoWrapPolicy = math::angle::Signed>
+class tQuaternionOrientation
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+
+  //! The orientation type with Euler angle storage this class interconverts with.
+  typedef tOrientation<3, TElement, si_units::tNoUnit, TAutoWrapPolicy> tEulerOrientation;
+
+  template <typename TAngleElement = TElement, typename TAngleUnitPolicy = math::angle::Radian, typename TAngleAutoWrapPolicy = TAutoWrapPolicy>
+  using tComponent = typename tEulerOrientation::template tComponent<TAngleElement, TAngleUnitPolicy, TAngleAutoWrapPolicy>;
+
+  static inline const tQuaternionOrientation &Identity()
+  {
+    static tQuaternionOrientation orientation;
+    return orientation;
+  }
+
+  tQuaternionOrientation();
+
+  //! Create an orientation from quaternion components
+  /*! The given quaternion does not need to have unit length and is normalized.
+   */
+  tQuaternionOrientation(TElement w, TElement x, TElement y, TElement z);
+
+  template <typename TRoll, typename TPitch, typename TYaw>
+  tQuaternionOrientation(TRoll roll, TPitch pitch, TYaw yaw);
+
+  template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+  tQuaternionOrientation(const tOrientation<3, TOtherElement, si_units::tNoUnit, TOtherAutoWrapPolicy> &orientation);
+
+  template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+  explicit tQuaternionOrientation(const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &other);
+
+  template <typename TMatrixElement>
+  explicit tQuaternionOrientation(const math::tMatrix<3, 3, TMatrixElement> &matrix);
+
+  //! Convert to roll, pitch and yaw
+  operator tEulerOrientation() const;
+
+  inline TElement W() const
+  {
+    return this->w;
+  }
+  inline TElement X() const
+  {
+    return this->x;
+  }
+  inline TElement Y() const
+  {
+    return this->y;
+  }
+  inline TElement Z() const
+  {
+    return this->z;
+  }
+
+  //! Get the roll angle of the orientation (computed from the quaternion).
+  tComponent<> Roll() const;
+  //! Get the pitch angle of the orientation (computed from the quaternion).
+  tComponent<> Pitch() const;
+  //! Get the yaw angle of the orientation (computed from the quaternion).
+  tComponent<> Yaw() const;
+
+  //! Get roll, pitch and yaw at once, which is cheaper than reading them separately
+  void GetRollPitchYaw(tComponent<> &roll, tComponent<> &pitch, tComponent<> &yaw) const;
+
+  void Set(TElement w, TElement x, TElement y, TElement z);
+
+  template <typename TRoll, typename TPitch, typename TYaw>
+  void Set(TRoll roll, TPitch pitch, TYaw yaw);
+
+  template <typename TMatrixElement>
+  void Set(const math::tMatrix<3, 3, TMatrixElement> &matrix);
+
+  void Normalize();
+
+  void Invert();
+
+  tQuaternionOrientation Inverted() const;
+
+  //! Concatenate a rotation given in the local frame of this orientation (this = this * other)
+  template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+  tQuaternionOrientation &operator *= (const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &other);
+
+  //! Rotate this orientation in its parent frame (this = rotation * this)
+  /*! This matches the semantics of tOrientation::Rotate.
+   */
+  template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+  void Rotate(const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &rotation);
+
+  template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+  tQuaternionOrientation Rotated(const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &rotation) const;
+
+  //! Rotate the given vector in place
+  void TransformVector(TElement(&vector)[3]) const;
+
+  math::tMatrix<3, 3, TElement> GetMatrix() const;
+
+  //! Fill a plain rotation matrix (see rotation_matrix.h)
+  void GetMatrix(TElement(&rotation)[3][3]) const;
+
+  math::tMatrix<4, 4, TElement> GetTransformationMatrix() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TElement w;
+  TElement x;
+  TElement y;
+  TElement z;
+
+  void SetFromRollPitchYaw(TElement roll, TElement pitch, TElement yaw);
+
+};
+
+
+template <typename TElement, typename TAutoWrapPolicy, typename TOtherElement, typename TOtherAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> operator * (const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &right);
+
+//! Spherical linear interpolation along the shorter arc from start to end
+/*! Factors outside [0, 1] extrapolate with constant angular velocity.
+ *  Falls back to \ref Nlerp when start and end are nearly the same.
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> Slerp(const tQuaternionOrientation<TElement, TAutoWrapPolicy> &start, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &end, TElement factor);
+
+//! Normalized linear interpolation along the shorter arc from start to end
+/*! Cheaper than \ref Slerp and accurate for small angles between start and end,
+ *  but the angular velocity is not constant.
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> Nlerp(const tQuaternionOrientation<TElement, TAutoWrapPolicy> &start, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &end, TElement factor);
+
+//! Check if left and right describe the same rotation
+/*! As q and -q are the same rotation, the sign of the quaternions is not taken into account.
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+bool IsEqual(const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &right, float max_error = 1E-6, math::tFloatComparisonMethod method = math::eFCM_ABSOLUTE_ERROR);
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator == (const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &right);
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator != (const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &right);
+
+template <typename TElement, typename TAutoWrapPolicy>
+std::ostream &operator << (std::ostream &stream, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation);
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation);
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation);
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/orientation/tQuaternionOrientation.hpp"
+
+#endif
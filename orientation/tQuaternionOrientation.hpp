@@ -0,0 +1,508 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/orientation/tQuaternionOrientation.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation constructors
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy>::tQuaternionOrientation() :
+  w(1),
+  x(0),
+  y(0),
+  z(0)
+{}
+
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy>::tQuaternionOrientation(TElement w, TElement x, TElement y, TElement z)
+{
+  this->Set(w, x, y, z);
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TRoll, typename TPitch, typename TYaw>
+tQuaternionOrientation<TElement, TAutoWrapPolicy>::tQuaternionOrientation(TRoll roll, TPitch pitch, TYaw yaw)
+{
+  this->Set(roll, pitch, yaw);
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy>::tQuaternionOrientation(const tOrientation<3, TOtherElement, si_units::tNoUnit, TOtherAutoWrapPolicy> &orientation)
+{
+  this->SetFromRollPitchYaw(orientation.Roll().Value().Value(), orientation.Pitch().Value().Value(), orientation.Yaw().Value().Value());
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy>::tQuaternionOrientation(const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &other) :
+  w(other.W()),
+  x(other.X()),
+  y(other.Y()),
+  z(other.Z())
+{}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TMatrixElement>
+tQuaternionOrientation<TElement, TAutoWrapPolicy>::tQuaternionOrientation(const math::tMatrix<3, 3, TMatrixElement> &matrix)
+{
+  this->Set(matrix);
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation conversion to tOrientation3D
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy>::operator tEulerOrientation() const
+{
+  tComponent<> roll, pitch, yaw;
+  this->GetRollPitchYaw(roll, pitch, yaw);
+  return tEulerOrientation(roll, pitch, yaw);
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation Roll, Pitch, Yaw
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+typename tQuaternionOrientation<TElement, TAutoWrapPolicy>::template tComponent<> tQuaternionOrientation<TElement, TAutoWrapPolicy>::Roll() const
+{
+  tComponent<> roll, pitch, yaw;
+  this->GetRollPitchYaw(roll, pitch, yaw);
+  return roll;
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+typename tQuaternionOrientation<TElement, TAutoWrapPolicy>::template tComponent<> tQuaternionOrientation<TElement, TAutoWrapPolicy>::Pitch() const
+{
+  tComponent<> roll, pitch, yaw;
+  this->GetRollPitchYaw(roll, pitch, yaw);
+  return pitch;
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+typename tQuaternionOrientation<TElement, TAutoWrapPolicy>::template tComponent<> tQuaternionOrientation<TElement, TAutoWrapPolicy>::Yaw() const
+{
+  tComponent<> roll, pitch, yaw;
+  this->GetRollPitchYaw(roll, pitch, yaw);
+  return yaw;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation GetRollPitchYaw
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::GetRollPitchYaw(tComponent<> &roll, tComponent<> &pitch, tComponent<> &yaw) const
+{
+  TElement rotation[3][3];
+  this->GetMatrix(rotation);
+  TElement roll_value, pitch_value, yaw_value;
+  orientation::ExtractRollPitchYaw(rotation, roll_value, pitch_value, yaw_value);
+  roll = tComponent<>(roll_value);
+  pitch = tComponent<>(pitch_value);
+  yaw = tComponent<>(yaw_value);
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation Set
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::Set(TElement w, TElement x, TElement y, TElement z)
+{
+  this->w = w;
+  this->x = x;
+  this->y = y;
+  this->z = z;
+  this->Normalize();
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TRoll, typename TPitch, typename TYaw>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::Set(TRoll roll, TPitch pitch, TYaw yaw)
+{
+  this->SetFromRollPitchYaw(tComponent<>(roll).Value().Value(), tComponent<>(pitch).Value().Value(), tComponent<>(yaw).Value().Value());
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TMatrixElement>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::Set(const math::tMatrix<3, 3, TMatrixElement> &matrix)
+{
+  const TElement trace = matrix[0][0] + matrix[1][1] + matrix[2][2];
+  if (trace > 0)
+  {
+    const TElement s = 2 * std::sqrt(trace + 1);
+    this->w = s / 4;
+    this->x = (matrix[2][1] - matrix[1][2]) / s;
+    this->y = (matrix[0][2] - matrix[2][0]) / s;
+    this->z = (matrix[1][0] - matrix[0][1]) / s;
+  }
+  else if (matrix[0][0] > matrix[1][1] && matrix[0][0] > matrix[2][2])
+  {
+    const TElement s = 2 * std::sqrt(1 + matrix[0][0] - matrix[1][1] - matrix[2][2]);
+    this->w = (matrix[2][1] - matrix[1][2]) / s;
+    this->x = s / 4;
+    this->y = (matrix[0][1] + matrix[1][0]) / s;
+    this->z = (matrix[0][2] + matrix[2][0]) / s;
+  }
+  else if (matrix[1][1] > matrix[2][2])
+  {
+    const TElement s = 2 * std::sqrt(1 + matrix[1][1] - matrix[0][0] - matrix[2][2]);
+    this->w = (matrix[0][2] - matrix[2][0]) / s;
+    this->x = (matrix[0][1] + matrix[1][0]) / s;
+    this->y = s / 4;
+    this->z = (matrix[1][2] + matrix[2][1]) / s;
+  }
+  else
+  {
+    const TElement s = 2 * std::sqrt(1 + matrix[2][2] - matrix[0][0] - matrix[1][1]);
+    this->w = (matrix[1][0] - matrix[0][1]) / s;
+    this->x = (matrix[0][2] + matrix[2][0]) / s;
+    this->y = (matrix[1][2] + matrix[2][1]) / s;
+    this->z = s / 4;
+  }
+  if (this->w < 0)
+  {
+    this->w = -this->w;
+    this->x = -this->x;
+    this->y = -this->y;
+    this->z = -this->z;
+  }
+  this->Normalize();
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation SetFromRollPitchYaw
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::SetFromRollPitchYaw(TElement roll, TElement pitch, TElement yaw)
+{
+  const TElement sin_roll = std::sin(roll / 2);
+  const TElement cos_roll = std::cos(roll / 2);
+  const TElement sin_pitch = std::sin(pitch / 2);
+  const TElement cos_pitch = std::cos(pitch / 2);
+  const TElement sin_yaw = std::sin(yaw / 2);
+  const TElement cos_yaw = std::cos(yaw / 2);
+
+  this->w = cos_roll * cos_pitch * cos_yaw + sin_roll * sin_pitch * sin_yaw;
+  this->x = sin_roll * cos_pitch * cos_yaw - cos_roll * sin_pitch * sin_yaw;
+  this->y = cos_roll * sin_pitch * cos_yaw + sin_roll * cos_pitch * sin_yaw;
+  this->z = cos_roll * cos_pitch * sin_yaw - sin_roll * sin_pitch * cos_yaw;
+  if (this->w < 0)
+  {
+    this->w = -this->w;
+    this->x = -this->x;
+    this->y = -this->y;
+    this->z = -this->z;
+  }
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation Normalize
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::Normalize()
+{
+  const TElement length = std::sqrt(this->w * this->w + this->x * this->x + this->y * this->y + this->z * this->z);
+  assert(length > 0);
+  this->w /= length;
+  this->x /= length;
+  this->y /= length;
+  this->z /= length;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation Invert
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::Invert()
+{
+  this->x = -this->x;
+  this->y = -this->y;
+  this->z = -this->z;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation Inverted
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> tQuaternionOrientation<TElement, TAutoWrapPolicy>::Inverted() const
+{
+  tQuaternionOrientation temp(*this);
+  temp.Invert();
+  return temp;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation operator *=
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> &tQuaternionOrientation<TElement, TAutoWrapPolicy>::operator *= (const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &other)
+{
+  const TElement w = this->w * other.W() - this->x * other.X() - this->y * other.Y() - this->z * other.Z();
+  const TElement x = this->w * other.X() + this->x * other.W() + this->y * other.Z() - this->z * other.Y();
+  const TElement y = this->w * other.Y() - this->x * other.Z() + this->y * other.W() + this->z * other.X();
+  const TElement z = this->w * other.Z() + this->x * other.Y() - this->y * other.X() + this->z * other.W();
+  this->w = w;
+  this->x = x;
+  this->y = y;
+  this->z = z;
+  this->Normalize();
+  return *this;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation Rotate
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::Rotate(const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &rotation)
+{
+  tQuaternionOrientation temp(rotation);
+  temp *= *this;
+  *this = temp;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation Rotated
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> tQuaternionOrientation<TElement, TAutoWrapPolicy>::Rotated(const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &rotation) const
+{
+  tQuaternionOrientation temp(*this);
+  temp.Rotate(rotation);
+  return temp;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation TransformVector
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::TransformVector(TElement(&vector)[3]) const
+{
+  // v' = v + w * t + u x t with t = 2 * (u x v) and u = (x, y, z)
+  const TElement t_x = 2 * (this->y * vector[2] - this->z * vector[1]);
+  const TElement t_y = 2 * (this->z * vector[0] - this->x * vector[2]);
+  const TElement t_z = 2 * (this->x * vector[1] - this->y * vector[0]);
+  vector[0] += this->w * t_x + this->y * t_z - this->z * t_y;
+  vector[1] += this->w * t_y + this->z * t_x - this->x * t_z;
+  vector[2] += this->w * t_z + this->x * t_y - this->y * t_x;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation GetMatrix
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+math::tMatrix<3, 3, TElement> tQuaternionOrientation<TElement, TAutoWrapPolicy>::GetMatrix() const
+{
+  TElement rotation[3][3];
+  this->GetMatrix(rotation);
+  return math::tMatrix<3, 3, TElement>(rotation[0][0], rotation[0][1], rotation[0][2],
+                                       rotation[1][0], rotation[1][1], rotation[1][2],
+                                       rotation[2][0], rotation[2][1], rotation[2][2]);
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionOrientation<TElement, TAutoWrapPolicy>::GetMatrix(TElement(&rotation)[3][3]) const
+{
+  const TElement xx = this->x * this->x;
+  const TElement yy = this->y * this->y;
+  const TElement zz = this->z * this->z;
+  const TElement xy = this->x * this->y;
+  const TElement xz = this->x * this->z;
+  const TElement yz = this->y * this->z;
+  const TElement wx = this->w * this->x;
+  const TElement wy = this->w * this->y;
+  const TElement wz = this->w * this->z;
+
+  rotation[0][0] = 1 - 2 * (yy + zz);
+  rotation[0][1] = 2 * (xy - wz);
+  rotation[0][2] = 2 * (xz + wy);
+  rotation[1][0] = 2 * (xy + wz);
+  rotation[1][1] = 1 - 2 * (xx + zz);
+  rotation[1][2] = 2 * (yz - wx);
+  rotation[2][0] = 2 * (xz - wy);
+  rotation[2][1] = 2 * (yz + wx);
+  rotation[2][2] = 1 - 2 * (xx + yy);
+}
+
+//----------------------------------------------------------------------
+// tQuaternionOrientation GetTransformationMatrix
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+math::tMatrix<4, 4, TElement> tQuaternionOrientation<TElement, TAutoWrapPolicy>::GetTransformationMatrix() const
+{
+  TElement rotation[3][3];
+  this->GetMatrix(rotation);
+  return math::tMatrix<4, 4, TElement>(rotation[0][0], rotation[0][1], rotation[0][2], 0,
+                                       rotation[1][0], rotation[1][1], rotation[1][2], 0,
+                                       rotation[2][0], rotation[2][1], rotation[2][2], 0,
+                                       0, 0, 0, 1);
+}
+
+//----------------------------------------------------------------------
+// Multiplication
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy, typename TOtherElement, typename TOtherAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> operator * (const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TOtherElement, TOtherAutoWrapPolicy> &right)
+{
+  tQuaternionOrientation<TElement, TAutoWrapPolicy> temp(left);
+  temp *= right;
+  return temp;
+}
+
+//----------------------------------------------------------------------
+// Slerp
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> Slerp(const tQuaternionOrientation<TElement, TAutoWrapPolicy> &start, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &end, TElement factor)
+{
+  TElement dot = start.W() * end.W() + start.X() * end.X() + start.Y() * end.Y() + start.Z() * end.Z();
+  const TElement sign = dot < 0 ? -1 : 1;
+  dot *= sign;
+  if (dot > TElement(0.9995))
+  {
+    return Nlerp(start, end, factor);
+  }
+  const TElement angle = std::acos(dot);
+  const TElement sin_angle = std::sin(angle);
+  const TElement start_weight = std::sin((1 - factor) * angle) / sin_angle;
+  const TElement end_weight = sign * std::sin(factor * angle) / sin_angle;
+  return tQuaternionOrientation<TElement, TAutoWrapPolicy>(start_weight * start.W() + end_weight * end.W(), start_weight * start.X() + end_weight * end.X(),
+         start_weight * start.Y() + end_weight * end.Y(), start_weight * start.Z() + end_weight * end.Z());
+}
+
+//----------------------------------------------------------------------
+// Nlerp
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionOrientation<TElement, TAutoWrapPolicy> Nlerp(const tQuaternionOrientation<TElement, TAutoWrapPolicy> &start, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &end, TElement factor)
+{
+  const TElement dot = start.W() * end.W() + start.X() * end.X() + start.Y() * end.Y() + start.Z() * end.Z();
+  const TElement start_weight = 1 - factor;
+  const TElement end_weight = dot < 0 ? -factor : factor;
+  return tQuaternionOrientation<TElement, TAutoWrapPolicy>(start_weight * start.W() + end_weight * end.W(), start_weight * start.X() + end_weight * end.X(),
+         start_weight * start.Y() + end_weight * end.Y(), start_weight * start.Z() + end_weight * end.Z());
+}
+
+//----------------------------------------------------------------------
+// Numeric equality
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+bool IsEqual(const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &right, float max_error, math::tFloatComparisonMethod method)
+{
+  const TElement dot = left.W() * right.W() + left.X() * right.X() + left.Y() * right.Y() + left.Z() * right.Z();
+  const TElement sign = dot < 0 ? -1 : 1;
+  return math::IsEqual(left.W(), sign * right.W(), max_error, method) && math::IsEqual(left.X(), sign * right.X(), max_error, method) &&
+         math::IsEqual(left.Y(), sign * right.Y(), max_error, method) && math::IsEqual(left.Z(), sign * right.Z(), max_error, method);
+}
+
+//----------------------------------------------------------------------
+// Equality
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator == (const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &right)
+{
+  return left.W() == right.W() && left.X() == right.X() && left.Y() == right.Y() && left.Z() == right.Z();
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator != (const tQuaternionOrientation<TElement, TAutoWrapPolicy> &left, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &right)
+{
+  return !(left == right);
+}
+
+//----------------------------------------------------------------------
+// Streaming
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+std::ostream &operator << (std::ostream &stream, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation)
+{
+  return stream << static_cast<typename tQuaternionOrientation<TElement, TAutoWrapPolicy>::tEulerOrientation>(orientation);
+}
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation)
+{
+  stream << orientation.W() << orientation.X() << orientation.Y() << orientation.Z();
+  return stream;
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation)
+{
+  TElement w, x, y, z;
+  stream >> w >> x >> y >> z;
+  orientation.Set(w, x, y, z);
+  return stream;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
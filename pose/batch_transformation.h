@@ -0,0 +1,200 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/batch_transformation.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains functions to transform many positions or poses at once
+ *
+ * All functions take a reference pose and a contiguous array of
+ * positions or poses given in the local frame of the reference and
+ * write them expressed in the parent frame of the reference, i.e. the
+ * batch equivalent of GetPoseInParentFrame. The rotation of the reference
+ * is computed only once per call.
+ *
+ * To transform into the local frame of a pose, pass its inverse as
+ * reference, e.g. TransformPositions(pose.Inverted(), ...).
+ *
+ * Input and output may be the same array.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__batch_transformation_h__
+#define __rrlib__localization__pose__batch_transformation_h__
+
+#include "rrlib/localization/pose/tPose2D.h"
+#include "rrlib/localization/pose/tPose3D.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+//! Transform 2D positions from the local frame of reference to its parent frame
+/*! \param reference The pose that defines the local frame
+ *  \param positions Pointer to the first of count positions
+ *  \param count     The number of positions to transform
+ *  \param result    Pointer to storage for count positions
+ */
+template <typename TElement, typename TSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy, typename TPositionElement>
+void TransformPositions(const tPose<2, TElement, TSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &reference, const tPosition<2, TPositionElement, TSIUnit> *positions, size_t count, tPosition<2, TPositionElement, TSIUnit> *result)
+{
+  const TPositionElement yaw = reference.Yaw().Value().Value();
+  const TPositionElement sin_yaw = std::sin(yaw);
+  const TPositionElement cos_yaw = std::cos(yaw);
+  const TPositionElement translation_x = reference.X().Value();
+  const TPositionElement translation_y = reference.Y().Value();
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const TPositionElement x = positions[i].X().Value();
+    const TPositionElement y = positions[i].Y().Value();
+    result[i] = tPosition<2, TPositionElement, TSIUnit>(translation_x + cos_yaw * x - sin_yaw * y,
+                                                        translation_y + sin_yaw * x + cos_yaw * y);
+  }
+}
+
+//! Transform 3D positions from the local frame of reference to its parent frame
+/*! \param reference The pose that defines the local frame
+ *  \param positions Pointer to the first of count positions
+ *  \param count     The number of positions to transform
+ *  \param result    Pointer to storage for count positions
+ */
+template <typename TElement, typename TSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy, typename TPositionElement>
+void TransformPositions(const tPose<3, TElement, TSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &reference, const tPosition<3, TPositionElement, TSIUnit> *positions, size_t count, tPosition<3, TPositionElement, TSIUnit> *result)
+{
+  TPositionElement rotation[3][3];
+  orientation::GetRotationMatrix<TPositionElement>(rotation, reference.Roll().Value().Value(), reference.Pitch().Value().Value(), reference.Yaw().Value().Value());
+  const TPositionElement translation_x = reference.X().Value();
+  const TPositionElement translation_y = reference.Y().Value();
+  const TPositionElement translation_z = reference.Z().Value();
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const TPositionElement x = positions[i].X().Value();
+    const TPositionElement y = positions[i].Y().Value();
+    const TPositionElement z = positions[i].Z().Value();
+    result[i] = tPosition<3, TPositionElement, TSIUnit>(translation_x + rotation[0][0] * x + rotation[0][1] * y + rotation[0][2] * z,
+                                                        translation_y + rotation[1][0] * x + rotation[1][1] * y + rotation[1][2] * z,
+                                                        translation_z + rotation[2][0] * x + rotation[2][1] * y + rotation[2][2] * z);
+  }
+}
+
+//! Transform 2D poses from the local frame of reference to its parent frame
+/*! result[i] equals poses[i].GetPoseInParentFrame(reference).
+ *  \param reference The pose that defines the local frame
+ *  \param poses     Pointer to the first of count poses
+ *  \param count     The number of poses to transform
+ *  \param result    Pointer to storage for count poses
+ */
+template <typename TReferenceElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TReferenceAutoWrapPolicy, typename TElement, typename TAutoWrapPolicy>
+void TransformPoses(const tPose<2, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference, const tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> *poses, size_t count, tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> *result)
+{
+  typedef tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose;
+  const TElement yaw = reference.Yaw().Value().Value();
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+  const TElement translation_x = reference.X().Value();
+  const TElement translation_y = reference.Y().Value();
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const TElement x = poses[i].X().Value();
+    const TElement y = poses[i].Y().Value();
+    result[i] = tPose(translation_x + cos_yaw * x - sin_yaw * y,
+                      translation_y + sin_yaw * x + cos_yaw * y,
+                      typename tPose::template tOrientationComponent<>(yaw + poses[i].Yaw().Value().Value()));
+  }
+}
+
+//! Transform 3D poses from the local frame of reference to its parent frame
+/*! result[i] equals poses[i].GetPoseInParentFrame(reference).
+ *  \param reference The pose that defines the local frame
+ *  \param poses     Pointer to the first of count poses
+ *  \param count     The number of poses to transform
+ *  \param result    Pointer to storage for count poses
+ */
+template <typename TReferenceElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TReferenceAutoWrapPolicy, typename TElement, typename TAutoWrapPolicy>
+void TransformPoses(const tPose<3, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference, const tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> *poses, size_t count, tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> *result)
+{
+  typedef tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose;
+  typedef typename tPose::template tOrientationComponent<> tAngle;
+  TElement rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(rotation, reference.Roll().Value().Value(), reference.Pitch().Value().Value(), reference.Yaw().Value().Value());
+  const TElement translation_x = reference.X().Value();
+  const TElement translation_y = reference.Y().Value();
+  const TElement translation_z = reference.Z().Value();
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    const TElement x = poses[i].X().Value();
+    const TElement y = poses[i].Y().Value();
+    const TElement z = poses[i].Z().Value();
+
+    TElement pose_rotation[3][3];
+    orientation::GetRotationMatrix<TElement>(pose_rotation, poses[i].Roll().Value().Value(), poses[i].Pitch().Value().Value(), poses[i].Yaw().Value().Value());
+    TElement combined_rotation[3][3];
+    orientation::Multiply(combined_rotation, rotation, pose_rotation);
+    TElement roll, pitch, yaw;
+    orientation::ExtractRollPitchYaw(combined_rotation, roll, pitch, yaw);
+
+    result[i] = tPose(translation_x + rotation[0][0] * x + rotation[0][1] * y + rotation[0][2] * z,
+                      translation_y + rotation[1][0] * x + rotation[1][1] * y + rotation[1][2] * z,
+                      translation_z + rotation[2][0] * x + rotation[2][1] * y + rotation[2][2] * z,
+                      tAngle(roll), tAngle(pitch), tAngle(yaw));
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
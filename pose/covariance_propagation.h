@@ -0,0 +1,215 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/covariance_propagation.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains functions for first order propagation of 6x6 pose covariances
+ *
+ * The Jacobians of compounding and inverting three dimensional poses
+ * consist of 3x3 blocks, of which some are zero or the identity. These
+ * functions evaluate J * covariance * J^T blockwise on plain arrays,
+ * which is much cheaper than dense 6x6 matrix products.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__uncertain_pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tUncertainPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__covariance_propagation_h__
+#define __rrlib__localization__pose__covariance_propagation_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tOrientation.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+namespace pose
+{
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+//! Copy the 3x3 block starting at (row, column) out of a 6x6 matrix
+template <typename TElement, typename TMatrix>
+inline void GetBlock(TElement(&block)[3][3], const TMatrix &matrix, size_t row, size_t column)
+{
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      block[i][j] = matrix[row + i][column + j];
+    }
+  }
+}
+
+//! Replace covariance by J * covariance * J^T with J = [[x, m], [0, n]]
+/*! \param covariance A symmetric 6x6 matrix, position first
+ *  \param x          Jacobian of the new position w.r.t. the old position
+ *  \param m          Jacobian of the new position w.r.t. the old orientation
+ *  \param n          Jacobian of the new orientation w.r.t. the old orientation
+ */
+template <typename TMatrix, typename TElement>
+inline void PropagateCovariance(TMatrix &covariance, const TElement(&x)[3][3], const TElement(&m)[3][3], const TElement(&n)[3][3])
+{
+  TElement position_position[3][3], position_orientation[3][3], orientation_orientation[3][3];
+  GetBlock(position_position, covariance, 0, 0);
+  GetBlock(position_orientation, covariance, 0, 3);
+  GetBlock(orientation_orientation, covariance, 3, 3);
+
+  TElement x_p[3][3], x_p_x[3][3], x_c[3][3], m_a[3][3], x_c_m[3][3], m_a_m[3][3];
+  orientation::Multiply(x_p, x, position_position);
+  orientation::MultiplyByTransposed(x_p_x, x_p, x);
+  orientation::Multiply(x_c, x, position_orientation);
+  orientation::Multiply(m_a, m, orientation_orientation);
+  orientation::MultiplyByTransposed(x_c_m, x_c, m);
+  orientation::MultiplyByTransposed(m_a_m, m_a, m);
+
+  TElement x_c_plus_m_a[3][3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      x_c_plus_m_a[i][j] = x_c[i][j] + m_a[i][j];
+    }
+  }
+  TElement new_position_orientation[3][3], n_a[3][3], new_orientation_orientation[3][3];
+  orientation::MultiplyByTransposed(new_position_orientation, x_c_plus_m_a, n);
+  orientation::Multiply(n_a, n, orientation_orientation);
+  orientation::MultiplyByTransposed(new_orientation_orientation, n_a, n);
+
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      covariance[i][j] = x_p_x[i][j] + x_c_m[i][j] + x_c_m[j][i] + m_a_m[i][j];
+      covariance[i][3 + j] = new_position_orientation[i][j];
+      covariance[3 + j][i] = new_position_orientation[i][j];
+      covariance[3 + i][3 + j] = new_orientation_orientation[i][j];
+    }
+  }
+}
+
+//! Replace covariance by J * covariance * J^T with J = [[I, m], [0, n]]
+/*! This is the common case of compounding, where the position is only shifted.
+ */
+template <typename TMatrix, typename TElement>
+inline void PropagateCovariance(TMatrix &covariance, const TElement(&m)[3][3], const TElement(&n)[3][3])
+{
+  TElement position_position[3][3], position_orientation[3][3], orientation_orientation[3][3];
+  GetBlock(position_position, covariance, 0, 0);
+  GetBlock(position_orientation, covariance, 0, 3);
+  GetBlock(orientation_orientation, covariance, 3, 3);
+
+  TElement m_a[3][3], c_m[3][3], m_a_m[3][3];
+  orientation::Multiply(m_a, m, orientation_orientation);
+  orientation::MultiplyByTransposed(c_m, position_orientation, m);
+  orientation::MultiplyByTransposed(m_a_m, m_a, m);
+
+  TElement c_plus_m_a[3][3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      c_plus_m_a[i][j] = position_orientation[i][j] + m_a[i][j];
+    }
+  }
+  TElement new_position_orientation[3][3], n_a[3][3], new_orientation_orientation[3][3];
+  orientation::MultiplyByTransposed(new_position_orientation, c_plus_m_a, n);
+  orientation::Multiply(n_a, n, orientation_orientation);
+  orientation::MultiplyByTransposed(new_orientation_orientation, n_a, n);
+
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      covariance[i][j] = position_position[i][j] + c_m[i][j] + c_m[j][i] + m_a_m[i][j];
+      covariance[i][3 + j] = new_position_orientation[i][j];
+      covariance[3 + j][i] = new_position_orientation[i][j];
+      covariance[3 + i][3 + j] = new_orientation_orientation[i][j];
+    }
+  }
+}
+
+//! Add J * other * J^T with J = [[r, 0], [0, k]] to covariance
+/*! \param covariance The symmetric 6x6 matrix to add to
+ *  \param other      A symmetric 6x6 matrix, e.g. the covariance of an independent relative transformation
+ *  \param r          Jacobian of the position part
+ *  \param k          Jacobian of the orientation part
+ *  \param factor     Scales the added matrix, e.g. by the squared elapsed time when other is the covariance of a twist
+ */
+template <typename TMatrix, typename TOtherMatrix, typename TElement>
+inline void AddPropagatedCovariance(TMatrix &covariance, const TOtherMatrix &other, const TElement(&r)[3][3], const TElement(&k)[3][3], TElement factor = 1)
+{
+  TElement position_position[3][3], position_orientation[3][3], orientation_orientation[3][3];
+  GetBlock(position_position, other, 0, 0);
+  GetBlock(position_orientation, other, 0, 3);
+  GetBlock(orientation_orientation, other, 3, 3);
+
+  TElement temp[3][3], r_p_r[3][3], r_c_k[3][3], k_a_k[3][3];
+  orientation::Multiply(temp, r, position_position);
+  orientation::MultiplyByTransposed(r_p_r, temp, r);
+  orientation::Multiply(temp, r, position_orientation);
+  orientation::MultiplyByTransposed(r_c_k, temp, k);
+  orientation::Multiply(temp, k, orientation_orientation);
+  orientation::MultiplyByTransposed(k_a_k, temp, k);
+
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      covariance[i][j] += factor * r_p_r[i][j];
+      covariance[i][3 + j] += factor * r_c_k[i][j];
+      covariance[3 + j][i] += factor * r_c_k[i][j];
+      covariance[3 + i][3 + j] += factor * k_a_k[i][j];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#endif
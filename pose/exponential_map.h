@@ -0,0 +1,338 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/exponential_map.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains the exponential and logarithm maps of SE(2) and SE(3)
+ *
+ * A tangent element is stored in a \ref tPose with meters and radians,
+ * i.e. the type of twist * time: the position holds the linear part and
+ * the orientation components hold the angular part about the x, y and z
+ * axes (not Euler angles).
+ *
+ * Exp(twist, time) moves along the twist for the given time with
+ * constant body velocities, which is exact in contrast to applying
+ * twist * time as relative transformation. Log(pose) / time yields the
+ * constant twist that reaches pose after time.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__exponential_map_h__
+#define __rrlib__localization__pose__exponential_map_h__
+
+#include "rrlib/localization/pose/tPose2D.h"
+#include "rrlib/localization/pose/tPose3D.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+namespace pose
+{
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+//! Below this squared angle the coefficients are evaluated by their Taylor series
+const double cEXPONENTIAL_MAP_TAYLOR_THRESHOLD = 1E-2;
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+//! Coefficients sin(t)/t, (1-cos(t))/t^2 and (t-sin(t))/t^3 of the SE(3) exponential
+template <typename TElement>
+inline void GetExponentialCoefficients(TElement angle_squared, TElement &a, TElement &b, TElement &c)
+{
+  if (angle_squared < cEXPONENTIAL_MAP_TAYLOR_THRESHOLD)
+  {
+    const TElement t2 = angle_squared;
+    a = 1 - t2 / 6 * (1 - t2 / 20 * (1 - t2 / 42));
+    b = TElement(0.5) * (1 - t2 / 12 * (1 - t2 / 30 * (1 - t2 / 56)));
+    c = (1 - t2 / 20 * (1 - t2 / 42 * (1 - t2 / 72))) / 6;
+    return;
+  }
+  const TElement angle = std::sqrt(angle_squared);
+  const TElement sin_angle = std::sin(angle);
+  const TElement cos_angle = std::cos(angle);
+  a = sin_angle / angle;
+  b = (1 - cos_angle) / angle_squared;
+  c = (angle - sin_angle) / (angle_squared * angle);
+}
+
+//! Rotation matrix and left jacobian of the rotation vector omega
+template <typename TElement>
+inline void ExponentialSO3(const TElement(&omega)[3], TElement(&rotation)[3][3], TElement(&jacobian)[3][3])
+{
+  const TElement xx = omega[0] * omega[0];
+  const TElement yy = omega[1] * omega[1];
+  const TElement zz = omega[2] * omega[2];
+  const TElement xy = omega[0] * omega[1];
+  const TElement xz = omega[0] * omega[2];
+  const TElement yz = omega[1] * omega[2];
+  TElement a, b, c;
+  GetExponentialCoefficients(xx + yy + zz, a, b, c);
+
+  // R = I + a * W + b * W^2 and V = I + b * W + c * W^2 with W = [omega]x
+  rotation[0][0] = 1 - b * (yy + zz);
+  rotation[0][1] = -a * omega[2] + b * xy;
+  rotation[0][2] = a * omega[1] + b * xz;
+  rotation[1][0] = a * omega[2] + b * xy;
+  rotation[1][1] = 1 - b * (xx + zz);
+  rotation[1][2] = -a * omega[0] + b * yz;
+  rotation[2][0] = -a * omega[1] + b * xz;
+  rotation[2][1] = a * omega[0] + b * yz;
+  rotation[2][2] = 1 - b * (xx + yy);
+
+  jacobian[0][0] = 1 - c * (yy + zz);
+  jacobian[0][1] = -b * omega[2] + c * xy;
+  jacobian[0][2] = b * omega[1] + c * xz;
+  jacobian[1][0] = b * omega[2] + c * xy;
+  jacobian[1][1] = 1 - c * (xx + zz);
+  jacobian[1][2] = -b * omega[0] + c * yz;
+  jacobian[2][0] = -b * omega[1] + c * xz;
+  jacobian[2][1] = b * omega[0] + c * yz;
+  jacobian[2][2] = 1 - c * (xx + yy);
+}
+
+//! Rotation vector of a rotation matrix and the inverse of its left jacobian
+template <typename TElement>
+inline void LogarithmSO3(const TElement(&rotation)[3][3], TElement(&omega)[3], TElement(&inverse_jacobian)[3][3])
+{
+  const TElement cos_angle = std::max<TElement>(-1, std::min<TElement>(1, (rotation[0][0] + rotation[1][1] + rotation[2][2] - 1) / 2));
+  const TElement angle = std::acos(cos_angle);
+  const TElement angle_squared = angle * angle;
+  TElement a, b, c;
+  GetExponentialCoefficients(angle_squared, a, b, c);
+
+  const TElement skew[3] = { rotation[2][1] - rotation[1][2], rotation[0][2] - rotation[2][0], rotation[1][0] - rotation[0][1] };
+  if (cos_angle > -0.99)
+  {
+    // (R - R^T) / 2 = a * W
+    for (size_t i = 0; i < 3; ++i)
+    {
+      omega[i] = skew[i] / (2 * a);
+    }
+  }
+  else
+  {
+    // Close to pi a vanishes, but (R + R^T) / 2 = I + b * (omega * omega^T - angle^2 * I) is well conditioned
+    TElement outer[3][3];
+    for (size_t i = 0; i < 3; ++i)
+    {
+      for (size_t j = 0; j < 3; ++j)
+      {
+        outer[i][j] = ((rotation[i][j] + rotation[j][i]) / 2 - (i == j ? 1 : 0)) / b + (i == j ? angle_squared : 0);
+      }
+    }
+    size_t k = 0;
+    for (size_t i = 1; i < 3; ++i)
+    {
+      if (outer[i][i] > outer[k][k])
+      {
+        k = i;
+      }
+    }
+    const TElement omega_k = std::sqrt(std::max<TElement>(0, outer[k][k]));
+    for (size_t i = 0; i < 3; ++i)
+    {
+      omega[i] = i == k ? omega_k : outer[k][i] / omega_k;
+    }
+    if (omega[0] * skew[0] + omega[1] * skew[1] + omega[2] * skew[2] < 0)
+    {
+      for (size_t i = 0; i < 3; ++i)
+      {
+        omega[i] = -omega[i];
+      }
+    }
+  }
+
+  // V^-1 = I - W / 2 + d * W^2 with d = (1 - a / (2 * b)) / angle^2
+  TElement d;
+  if (angle_squared < cEXPONENTIAL_MAP_TAYLOR_THRESHOLD)
+  {
+    const TElement t2 = angle_squared;
+    d = (1 + t2 / 60 * (1 + t2 / 42 * (1 + t2 / 40))) / 12;
+  }
+  else
+  {
+    d = (1 - a / (2 * b)) / angle_squared;
+  }
+  const TElement xx = omega[0] * omega[0];
+  const TElement yy = omega[1] * omega[1];
+  const TElement zz = omega[2] * omega[2];
+  inverse_jacobian[0][0] = 1 - d * (yy + zz);
+  inverse_jacobian[0][1] = omega[2] / 2 + d * omega[0] * omega[1];
+  inverse_jacobian[0][2] = -omega[1] / 2 + d * omega[0] * omega[2];
+  inverse_jacobian[1][0] = -omega[2] / 2 + d * omega[0] * omega[1];
+  inverse_jacobian[1][1] = 1 - d * (xx + zz);
+  inverse_jacobian[1][2] = omega[0] / 2 + d * omega[1] * omega[2];
+  inverse_jacobian[2][0] = omega[1] / 2 + d * omega[0] * omega[2];
+  inverse_jacobian[2][1] = -omega[0] / 2 + d * omega[1] * omega[2];
+  inverse_jacobian[2][2] = 1 - d * (xx + yy);
+}
+
+//! Coefficients sin(t)/t and (1-cos(t))/t of the SE(2) exponential
+template <typename TElement>
+inline void GetExponentialCoefficients2D(TElement angle, TElement &a, TElement &b)
+{
+  const TElement angle_squared = angle * angle;
+  if (angle_squared < cEXPONENTIAL_MAP_TAYLOR_THRESHOLD)
+  {
+    const TElement t2 = angle_squared;
+    a = 1 - t2 / 6 * (1 - t2 / 20 * (1 - t2 / 42));
+    b = angle / 2 * (1 - t2 / 12 * (1 - t2 / 30 * (1 - t2 / 56)));
+    return;
+  }
+  a = std::sin(angle) / angle;
+  b = (1 - std::cos(angle)) / angle;
+}
+
+}
+
+//! The exponential map of SE(2)
+/*! \param tangent Linear part in the position and angle in the yaw component
+ *  \returns The pose reached by moving along tangent for unit time
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::Signed> Exp(const tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &tangent)
+{
+  typedef tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::Signed> tResult;
+  const TElement x = tangent.X().Value();
+  const TElement y = tangent.Y().Value();
+  const TElement angle = tangent.Yaw().Value().Value();
+  TElement a, b;
+  pose::GetExponentialCoefficients2D(angle, a, b);
+  return tResult(a * x - b * y, b * x + a * y, typename tResult::template tOrientationComponent<>(angle));
+}
+
+//! The exponential map of SE(3)
+/*! \param tangent Linear part in the position and rotation vector in the orientation components
+ *  \returns The pose reached by moving along tangent for unit time
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::Signed> Exp(const tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &tangent)
+{
+  typedef tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::Signed> tResult;
+  const TElement omega[3] = { tangent.Roll().Value().Value(), tangent.Pitch().Value().Value(), tangent.Yaw().Value().Value() };
+  TElement rotation[3][3];
+  TElement jacobian[3][3];
+  pose::ExponentialSO3(omega, rotation, jacobian);
+
+  const TElement translation[3] = { tangent.X().Value(), tangent.Y().Value(), tangent.Z().Value() };
+  TElement position[3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    position[i] = jacobian[i][0] * translation[0] + jacobian[i][1] * translation[1] + jacobian[i][2] * translation[2];
+  }
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(rotation, roll, pitch, yaw);
+  typedef typename tResult::template tOrientationComponent<> tAngle;
+  return tResult(position[0], position[1], position[2], tAngle(roll), tAngle(pitch), tAngle(yaw));
+}
+
+//! Integrate a constant twist over time
+/*! In contrast to ApplyRelativePoseTransformation(twist * time) the
+ *  coupling of linear and angular motion is taken into account exactly.
+ *  \param twist The linear and angular velocities in the local frame
+ *  \param time  The duration of the motion
+ *  \returns The relative transformation after time
+ */
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy, typename TValue>
+auto Exp(const tPose < Tdimension, TElement, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, TAutoWrapPolicy > &twist, si_units::tTime<TValue> time) -> decltype(Exp(twist * time))
+{
+  return Exp(twist * time);
+}
+
+//! The logarithm map of SE(2)
+/*! Inverse of \ref Exp for angles in (-pi, pi]
+ *  \param pose The pose to compute the tangent element for
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::NoWrap> Log(const tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &pose)
+{
+  typedef tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::NoWrap> tResult;
+  const TElement x = pose.X().Value();
+  const TElement y = pose.Y().Value();
+  const TElement angle = std::atan2(std::sin(pose.Yaw().Value().Value()), std::cos(pose.Yaw().Value().Value()));
+  TElement a, b;
+  pose::GetExponentialCoefficients2D(angle, a, b);
+  const TElement determinant = a * a + b * b;
+  return tResult((a * x + b * y) / determinant, (a * y - b * x) / determinant, typename tResult::template tOrientationComponent<>(angle));
+}
+
+//! The logarithm map of SE(3)
+/*! Inverse of \ref Exp for rotation angles in [0, pi]
+ *  \param pose The pose to compute the tangent element for
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::NoWrap> Log(const tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &pose)
+{
+  typedef tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, math::angle::NoWrap> tResult;
+  TElement rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(rotation, pose.Roll().Value().Value(), pose.Pitch().Value().Value(), pose.Yaw().Value().Value());
+  TElement omega[3];
+  TElement inverse_jacobian[3][3];
+  pose::LogarithmSO3(rotation, omega, inverse_jacobian);
+
+  const TElement position[3] = { pose.X().Value(), pose.Y().Value(), pose.Z().Value() };
+  TElement translation[3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    translation[i] = inverse_jacobian[i][0] * position[0] + inverse_jacobian[i][1] * position[1] + inverse_jacobian[i][2] * position[2];
+  }
+  typedef typename tResult::template tOrientationComponent<> tAngle;
+  return tResult(translation[0], translation[1], translation[2], tAngle(omega[0]), tAngle(omega[1]), tAngle(omega[2]));
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
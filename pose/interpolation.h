@@ -0,0 +1,211 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/interpolation.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains functions to interpolate between two poses
+ *
+ * The interpolation factor is 0 at start and 1 at end. Factors outside
+ * [0, 1] extrapolate. To get the pose at time t between two samples at
+ * t0 and t1, use the factor (t - t0) / (t1 - t0).
+ *
+ * Orientations are always interpolated along the shorter arc, which is
+ * correct across the wrap-around of the angles in contrast to a linear
+ * interpolation of roll, pitch and yaw.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__interpolation_h__
+#define __rrlib__localization__pose__interpolation_h__
+
+#include "rrlib/localization/pose/tPose2D.h"
+#include "rrlib/localization/pose/tPose3D.h"
+#include "rrlib/localization/pose/exponential_map.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+enum tInterpolationMethod
+{
+  eIM_SLERP,     //!< Linear interpolation of the position and spherical linear interpolation of the orientation
+  eIM_NLERP,     //!< Like eIM_SLERP but with normalized linear interpolation of the orientation, which is faster and suited for small deltas
+  eIM_GEODESIC   //!< Motion with constant twist from start to end, i.e. the geodesic of SE(2) or SE(3)
+};
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+//! Interpolate between two 2D poses for many factors at once
+/*! The values that only depend on start and end are computed once per call.
+ *  In 2D, eIM_SLERP and eIM_NLERP are the same.
+ *  \param start   The pose for factor 0
+ *  \param end     The pose for factor 1
+ *  \param factors Pointer to the first of count interpolation factors
+ *  \param count   The number of factors
+ *  \param result  Pointer to storage for count poses
+ *  \param method  The interpolation method
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+void Interpolate(const tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &start, const tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &end,
+                 const double *factors, size_t count, tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> *result, tInterpolationMethod method = eIM_SLERP)
+{
+  typedef tPose<2, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> tPose;
+  if (method == eIM_GEODESIC)
+  {
+    const auto tangent = Log(end.GetPoseInLocalFrame(start));
+    for (size_t i = 0; i < count; ++i)
+    {
+      tPose pose(start);
+      pose.ApplyRelativePoseTransformation(Exp(tangent * TElement(factors[i])));
+      result[i] = pose;
+    }
+    return;
+  }
+
+  const TElement start_x = start.X().Value();
+  const TElement start_y = start.Y().Value();
+  const TElement start_yaw = start.Yaw().Value().Value();
+  const TElement delta_x = end.X().Value() - start_x;
+  const TElement delta_y = end.Y().Value() - start_y;
+  const TElement delta_yaw = std::atan2(std::sin(end.Yaw().Value().Value() - start_yaw), std::cos(end.Yaw().Value().Value() - start_yaw));
+  for (size_t i = 0; i < count; ++i)
+  {
+    const TElement factor = factors[i];
+    result[i] = tPose(start_x + factor * delta_x, start_y + factor * delta_y, typename tPose::template tOrientationComponent<>(start_yaw + factor * delta_yaw));
+  }
+}
+
+//! Interpolate between two 3D poses for many factors at once
+/*! The values that only depend on start and end are computed once per call.
+ *  \param start   The pose for factor 0
+ *  \param end     The pose for factor 1
+ *  \param factors Pointer to the first of count interpolation factors
+ *  \param count   The number of factors
+ *  \param result  Pointer to storage for count poses
+ *  \param method  The interpolation method
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+void Interpolate(const tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &start, const tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &end,
+                 const double *factors, size_t count, tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> *result, tInterpolationMethod method = eIM_SLERP)
+{
+  typedef tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> tPose;
+  if (method == eIM_GEODESIC)
+  {
+    const auto tangent = Log(end.GetPoseInLocalFrame(start));
+    for (size_t i = 0; i < count; ++i)
+    {
+      tPose pose(start);
+      pose.ApplyRelativePoseTransformation(Exp(tangent * TElement(factors[i])));
+      result[i] = pose;
+    }
+    return;
+  }
+
+  typedef tQuaternionOrientation<TElement, TAutoWrapPolicy> tQuaternion;
+  const tQuaternion start_orientation(start.Orientation());
+  const tQuaternion end_orientation(end.Orientation());
+  const TElement start_quaternion[4] = { start_orientation.W(), start_orientation.X(), start_orientation.Y(), start_orientation.Z() };
+  TElement end_quaternion[4] = { end_orientation.W(), end_orientation.X(), end_orientation.Y(), end_orientation.Z() };
+  TElement dot = 0;
+  for (size_t j = 0; j < 4; ++j)
+  {
+    dot += start_quaternion[j] * end_quaternion[j];
+  }
+  if (dot < 0)
+  {
+    for (size_t j = 0; j < 4; ++j)
+    {
+      end_quaternion[j] = -end_quaternion[j];
+    }
+    dot = -dot;
+  }
+  const bool spherical = method == eIM_SLERP && dot < TElement(0.9995);
+  const TElement angle = spherical ? std::acos(dot) : 0;
+  const TElement sin_angle = spherical ? std::sin(angle) : 1;
+
+  const TElement start_position[3] = { start.X().Value(), start.Y().Value(), start.Z().Value() };
+  const TElement delta_position[3] = { end.X().Value() - start_position[0], end.Y().Value() - start_position[1], end.Z().Value() - start_position[2] };
+  for (size_t i = 0; i < count; ++i)
+  {
+    const TElement factor = factors[i];
+    const TElement start_weight = spherical ? std::sin((1 - factor) * angle) / sin_angle : 1 - factor;
+    const TElement end_weight = spherical ? std::sin(factor * angle) / sin_angle : factor;
+    const tQuaternion orientation(start_weight * start_quaternion[0] + end_weight * end_quaternion[0], start_weight * start_quaternion[1] + end_weight * end_quaternion[1],
+                                  start_weight * start_quaternion[2] + end_weight * end_quaternion[2], start_weight * start_quaternion[3] + end_weight * end_quaternion[3]);
+    typename tQuaternion::template tComponent<> roll, pitch, yaw;
+    orientation.GetRollPitchYaw(roll, pitch, yaw);
+    result[i] = tPose(start_position[0] + factor * delta_position[0], start_position[1] + factor * delta_position[1], start_position[2] + factor * delta_position[2], roll, pitch, yaw);
+  }
+}
+
+//! Interpolate between two poses
+/*! \param start  The pose for factor 0
+ *  \param end    The pose for factor 1
+ *  \param factor The interpolation factor
+ *  \param method The interpolation method
+ */
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+tPose<Tdimension, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> Interpolate(const tPose<Tdimension, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &start,
+    const tPose<Tdimension, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> &end, double factor, tInterpolationMethod method = eIM_SLERP)
+{
+  tPose<Tdimension, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> result;
+  Interpolate(start, end, &factor, 1, &result, method);
+  return result;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
@@ -0,0 +1,184 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPackedCovariance.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tPackedCovariance
+ *
+ * \b tPackedCovariance
+ *
+ * A symmetric matrix that only stores its upper triangle row by row,
+ * i.e. 6 instead of 9 values for 2D poses and 21 instead of 36 values
+ * for 3D poses. The kernels visit every stored value once and only
+ * compute the upper triangle of their results.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__uncertain_pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tUncertainPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__tPackedCovariance_h__
+#define __rrlib__localization__pose__tPackedCovariance_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/math/tMatrix.h"
+
+#include <cstddef>
+#include <iostream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Symmetric covariance matrix in packed upper triangular storage
+/*! \tparam Tsize    The number of rows and columns
+ *  \tparam TElement The type of the stored values
+ */
+template <size_t Tsize, typename TElement = double>
+class tPackedCovariance
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+
+  static const size_t cSIZE = Tsize;
+  static const size_t cNUMBER_OF_VALUES = Tsize * (Tsize + 1) / 2;
+
+  //! Create a zero matrix
+  tPackedCovariance();
+
+  //! Pack the upper triangle of a dense matrix, which is assumed to be symmetric
+  template <typename TMatrixElement>
+  explicit tPackedCovariance(const math::tMatrix<Tsize, Tsize, TMatrixElement> &matrix);
+
+  //! The position of element (row, column) in the packed storage
+  static inline size_t Index(size_t row, size_t column)
+  {
+    return row <= column ? row * (2 * Tsize - row + 1) / 2 + column - row : Index(column, row);
+  }
+
+  inline const TElement &operator()(size_t row, size_t column) const
+  {
+    return this->values[Index(row, column)];
+  }
+  inline TElement &operator()(size_t row, size_t column)
+  {
+    return this->values[Index(row, column)];
+  }
+
+  inline const TElement *Values() const
+  {
+    return this->values;
+  }
+  inline TElement *Values()
+  {
+    return this->values;
+  }
+
+  //! Unpack into a dense matrix
+  math::tMatrix<Tsize, Tsize, TElement> GetMatrix() const;
+
+  tPackedCovariance &operator += (const tPackedCovariance &other);
+
+  tPackedCovariance &operator *= (TElement factor);
+
+  //! Multiply with a vector (result = this * vector)
+  /*! \note result must not alias vector
+   */
+  void Multiply(const TElement(&vector)[Tsize], TElement(&result)[Tsize]) const;
+
+  //! Apply a congruence transformation (this = jacobian * this * jacobian^T)
+  /*! This is the first order propagation of the covariance through a
+   *  function with the given Jacobian.
+   */
+  void CongruenceTransform(const TElement(&jacobian)[Tsize][Tsize]);
+
+  //! Add a congruence transformed matrix (this += factor * jacobian * other * jacobian^T)
+  /*! \note other must not alias this
+   */
+  void AddCongruenceTransform(const tPackedCovariance &other, const TElement(&jacobian)[Tsize][Tsize], TElement factor = 1);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  TElement values[cNUMBER_OF_VALUES];
+
+  //! result = jacobian * this
+  void MultiplyFromLeft(const TElement(&jacobian)[Tsize][Tsize], TElement(&result)[Tsize][Tsize]) const;
+
+};
+
+//----------------------------------------------------------------------
+// Operators
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+tPackedCovariance<Tsize, TElement> operator + (const tPackedCovariance<Tsize, TElement> &left, const tPackedCovariance<Tsize, TElement> &right);
+
+template <size_t Tsize, typename TElement>
+bool operator == (const tPackedCovariance<Tsize, TElement> &left, const tPackedCovariance<Tsize, TElement> &right);
+
+template <size_t Tsize, typename TElement>
+bool operator != (const tPackedCovariance<Tsize, TElement> &left, const tPackedCovariance<Tsize, TElement> &right);
+
+template <size_t Tsize, typename TElement>
+std::ostream &operator << (std::ostream &stream, const tPackedCovariance<Tsize, TElement> &covariance);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/pose/tPackedCovariance.hpp"
+
+#endif
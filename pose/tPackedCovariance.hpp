@@ -0,0 +1,281 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPackedCovariance.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+const size_t tPackedCovariance<Tsize, TElement>::cSIZE;
+template <size_t Tsize, typename TElement>
+const size_t tPackedCovariance<Tsize, TElement>::cNUMBER_OF_VALUES;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tPackedCovariance constructors
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+tPackedCovariance<Tsize, TElement>::tPackedCovariance()
+{
+  for (size_t i = 0; i < cNUMBER_OF_VALUES; ++i)
+  {
+    this->values[i] = 0;
+  }
+}
+
+template <size_t Tsize, typename TElement>
+template <typename TMatrixElement>
+tPackedCovariance<Tsize, TElement>::tPackedCovariance(const math::tMatrix<Tsize, Tsize, TMatrixElement> &matrix)
+{
+  TElement *value = this->values;
+  for (size_t i = 0; i < Tsize; ++i)
+  {
+    for (size_t j = i; j < Tsize; ++j)
+    {
+      *value++ = matrix[i][j];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tPackedCovariance GetMatrix
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+math::tMatrix<Tsize, Tsize, TElement> tPackedCovariance<Tsize, TElement>::GetMatrix() const
+{
+  math::tMatrix<Tsize, Tsize, TElement> matrix;
+  const TElement *value = this->values;
+  for (size_t i = 0; i < Tsize; ++i)
+  {
+    for (size_t j = i; j < Tsize; ++j)
+    {
+      matrix[i][j] = *value;
+      matrix[j][i] = *value;
+      ++value;
+    }
+  }
+  return matrix;
+}
+
+//----------------------------------------------------------------------
+// tPackedCovariance operator +=
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+tPackedCovariance<Tsize, TElement> &tPackedCovariance<Tsize, TElement>::operator += (const tPackedCovariance &other)
+{
+  for (size_t i = 0; i < cNUMBER_OF_VALUES; ++i)
+  {
+    this->values[i] += other.values[i];
+  }
+  return *this;
+}
+
+//----------------------------------------------------------------------
+// tPackedCovariance operator *=
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+tPackedCovariance<Tsize, TElement> &tPackedCovariance<Tsize, TElement>::operator *= (TElement factor)
+{
+  for (size_t i = 0; i < cNUMBER_OF_VALUES; ++i)
+  {
+    this->values[i] *= factor;
+  }
+  return *this;
+}
+
+//----------------------------------------------------------------------
+// tPackedCovariance Multiply
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+void tPackedCovariance<Tsize, TElement>::Multiply(const TElement(&vector)[Tsize], TElement(&result)[Tsize]) const
+{
+  for (size_t i = 0; i < Tsize; ++i)
+  {
+    result[i] = 0;
+  }
+  const TElement *value = this->values;
+  for (size_t i = 0; i < Tsize; ++i)
+  {
+    result[i] += *value++ * vector[i];
+    for (size_t j = i + 1; j < Tsize; ++j)
+    {
+      result[i] += *value * vector[j];
+      result[j] += *value * vector[i];
+      ++value;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tPackedCovariance MultiplyFromLeft
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+void tPackedCovariance<Tsize, TElement>::MultiplyFromLeft(const TElement(&jacobian)[Tsize][Tsize], TElement(&result)[Tsize][Tsize]) const
+{
+  for (size_t i = 0; i < Tsize; ++i)
+  {
+    for (size_t j = 0; j < Tsize; ++j)
+    {
+      result[i][j] = 0;
+    }
+  }
+  const TElement *value = this->values;
+  for (size_t k = 0; k < Tsize; ++k)
+  {
+    for (size_t i = 0; i < Tsize; ++i)
+    {
+      result[i][k] += jacobian[i][k] * *value;
+    }
+    ++value;
+    for (size_t l = k + 1; l < Tsize; ++l)
+    {
+      for (size_t i = 0; i < Tsize; ++i)
+      {
+        result[i][l] += jacobian[i][k] * *value;
+        result[i][k] += jacobian[i][l] * *value;
+      }
+      ++value;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tPackedCovariance CongruenceTransform
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+void tPackedCovariance<Tsize, TElement>::CongruenceTransform(const TElement(&jacobian)[Tsize][Tsize])
+{
+  TElement temp[Tsize][Tsize];
+  this->MultiplyFromLeft(jacobian, temp);
+  TElement *value = this->values;
+  for (size_t i = 0; i < Tsize; ++i)
+  {
+    for (size_t j = i; j < Tsize; ++j)
+    {
+      TElement sum = 0;
+      for (size_t k = 0; k < Tsize; ++k)
+      {
+        sum += temp[i][k] * jacobian[j][k];
+      }
+      *value++ = sum;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tPackedCovariance AddCongruenceTransform
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+void tPackedCovariance<Tsize, TElement>::AddCongruenceTransform(const tPackedCovariance &other, const TElement(&jacobian)[Tsize][Tsize], TElement factor)
+{
+  TElement temp[Tsize][Tsize];
+  other.MultiplyFromLeft(jacobian, temp);
+  TElement *value = this->values;
+  for (size_t i = 0; i < Tsize; ++i)
+  {
+    for (size_t j = i; j < Tsize; ++j)
+    {
+      TElement sum = 0;
+      for (size_t k = 0; k < Tsize; ++k)
+      {
+        sum += temp[i][k] * jacobian[j][k];
+      }
+      *value++ += factor * sum;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// Operators
+//----------------------------------------------------------------------
+template <size_t Tsize, typename TElement>
+tPackedCovariance<Tsize, TElement> operator + (const tPackedCovariance<Tsize, TElement> &left, const tPackedCovariance<Tsize, TElement> &right)
+{
+  tPackedCovariance<Tsize, TElement> temp(left);
+  temp += right;
+  return temp;
+}
+
+template <size_t Tsize, typename TElement>
+bool operator == (const tPackedCovariance<Tsize, TElement> &left, const tPackedCovariance<Tsize, TElement> &right)
+{
+  for (size_t i = 0; i < tPackedCovariance<Tsize, TElement>::cNUMBER_OF_VALUES; ++i)
+  {
+    if (left.Values()[i] != right.Values()[i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Tsize, typename TElement>
+bool operator != (const tPackedCovariance<Tsize, TElement> &left, const tPackedCovariance<Tsize, TElement> &right)
+{
+  return !(left == right);
+}
+
+template <size_t Tsize, typename TElement>
+std::ostream &operator << (std::ostream &stream, const tPackedCovariance<Tsize, TElement> &covariance)
+{
+  return stream << covariance.GetMatrix();
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,176 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPackedUncertainPose2D.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tPackedUncertainPose2D
+ *
+ * \b tPackedUncertainPose2D
+ *
+ * The named covariance accessors of \ref tUncertainPose mapped onto
+ * the packed storage of \ref tPackedUncertainPoseBase.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__uncertain_pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tUncertainPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__tPackedUncertainPose2D_h__
+#define __rrlib__localization__pose__tPackedUncertainPose2D_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/pose/tPackedUncertainPoseBase.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Definition of an uncertain pose with packed covariance in the two dimensional case.
+/*! The pose is defined by a partial specialization of \ref tPackedUncertainPose
+ */
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+class tPackedUncertainPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> : public pose::tPackedUncertainPoseBase<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>
+{
+  typedef pose::tPackedUncertainPoseBase<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPoseBase;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef typename tPoseBase::tCovariance tCovariance;
+
+  using tPoseBase::tPoseBase;
+
+  tPackedUncertainPose() = default;
+
+  inline const TElement &CovarianceXX() const
+  {
+    return this->Covariance()(0, 0);
+  }
+  inline TElement &CovarianceXX()
+  {
+    return this->Covariance()(0, 0);
+  }
+
+  inline const TElement &CovarianceXY() const
+  {
+    return this->Covariance()(0, 1);
+  }
+  inline TElement &CovarianceXY()
+  {
+    return this->Covariance()(0, 1);
+  }
+
+  inline const TElement &CovarianceXYaw() const
+  {
+    return this->Covariance()(0, 2);
+  }
+  inline TElement &CovarianceXYaw()
+  {
+    return this->Covariance()(0, 2);
+  }
+
+  inline const TElement &CovarianceYY() const
+  {
+    return this->Covariance()(1, 1);
+  }
+  inline TElement &CovarianceYY()
+  {
+    return this->Covariance()(1, 1);
+  }
+
+  inline const TElement &CovarianceYYaw() const
+  {
+    return this->Covariance()(1, 2);
+  }
+  inline TElement &CovarianceYYaw()
+  {
+    return this->Covariance()(1, 2);
+  }
+
+  inline const TElement &CovarianceYawYaw() const
+  {
+    return this->Covariance()(2, 2);
+  }
+  inline TElement &CovarianceYawYaw()
+  {
+    return this->Covariance()(2, 2);
+  }
+
+  inline const TElement &VarianceX() const
+  {
+    return this->CovarianceXX();
+  }
+  inline TElement &VarianceX()
+  {
+    return this->CovarianceXX();
+  }
+
+  inline const TElement &VarianceY() const
+  {
+    return this->CovarianceYY();
+  }
+  inline TElement &VarianceY()
+  {
+    return this->CovarianceYY();
+  }
+
+  inline const TElement &VarianceYaw() const
+  {
+    return this->CovarianceYawYaw();
+  }
+  inline TElement &VarianceYaw()
+  {
+    return this->CovarianceYawYaw();
+  }
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#endif
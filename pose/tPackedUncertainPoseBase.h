@@ -0,0 +1,134 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPackedUncertainPoseBase.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tPackedUncertainPoseBase
+ *
+ * \b tPackedUncertainPoseBase
+ *
+ * Base class of uncertain poses that keep their covariance in packed
+ * upper triangular storage (see \ref tPackedCovariance). Compared to
+ * \ref tUncertainPose this saves 15 of 36 values in 3D and 3 of 9 values
+ * in 2D, which matters for large sets of particles or graph nodes.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__uncertain_pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tUncertainPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__tPackedUncertainPoseBase_h__
+#define __rrlib__localization__pose__tPackedUncertainPoseBase_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/pose/tPackedCovariance.h"
+#include "rrlib/localization/pose/tUncertainPoseBase.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+class tPackedUncertainPose;
+
+namespace pose
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Base class for poses with attached covariance matrix in packed storage
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+class tPackedUncertainPoseBase : public tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>
+{
+  template <typename TPoseElement = TElement>
+  using tPose = localization::tPose<Tdimension, TPoseElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>;
+
+  typedef localization::tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tUncertainPose;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  //! Position and orientation components: 2 + 1 in 2D and 3 + 3 in 3D
+  typedef tPackedCovariance < Tdimension * (Tdimension + 1) / 2, TElement > tCovariance;
+
+  using tPose<>::tPose;
+
+  tPackedUncertainPoseBase();
+
+  template <typename TPose>
+  tPackedUncertainPoseBase(const TPose &pose, const tCovariance &covariance);
+
+  //! Pack the covariance matrix of a dense uncertain pose
+  explicit tPackedUncertainPoseBase(const tUncertainPose &pose);
+
+  inline const tCovariance &Covariance() const
+  {
+    return this->covariance;
+  }
+  inline tCovariance &Covariance()
+  {
+    return this->covariance;
+  }
+
+  //! Unpack into an uncertain pose with dense covariance matrix
+  tUncertainPose GetUncertainPose() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tCovariance covariance;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#include "rrlib/localization/pose/tPackedUncertainPoseBase.hpp"
+
+#endif
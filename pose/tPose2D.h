@@ -176,6 +176,27 @@ public:
   template <typename TYaw>
   tPose Rotated(TYaw yaw) const;
 
+  //! Concatenate a relative transformation to this pose.
+  /*! The relative transformation is given in the local frame of this pose.
+   *  The yaw angles are simply added as rotations in the plane commute.
+   *  \param relative_transformation The transformation to apply.
+   */
+  template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
+  void ApplyRelativePoseTransformation(const tPose<2, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation);
+
+  //! Get this pose relative to the given reference pose.
+  /*! Uses the rigid transformation inverse of the reference, i.e. its
+   *  transposed rotation, instead of a general matrix inverse.
+   *  \param reference The pose this pose is expressed relative to.
+   */
+  template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
+  tPose GetPoseInLocalFrame(const tPose<2, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const;
+
+  //! Replace this pose by its inverse rigid transformation.
+  void Invert();
+
+  tPose Inverted() const;
+
   TElement GetEuclideanNorm() const;
 
 };
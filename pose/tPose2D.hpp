@@ -31,6 +31,8 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <cmath>
+
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
 #include <sstream>
 #endif
@@ -151,6 +153,68 @@ tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose<2
   return temp;
 }
 
+//----------------------------------------------------------------------
+// tPose2D ApplyRelativePoseTransformation
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
+void tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tPose<2, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation)
+{
+  const TElement yaw = this->Yaw().Value().Value();
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+
+  const TElement x = relative_transformation.X().Value();
+  const TElement y = relative_transformation.Y().Value();
+  this->SetPosition(this->X().Value() + cos_yaw * x - sin_yaw * y,
+                    this->Y().Value() + sin_yaw * x + cos_yaw * y);
+  this->Rotate(relative_transformation.Yaw());
+}
+
+//----------------------------------------------------------------------
+// tPose2D GetPoseInLocalFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
+tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::GetPoseInLocalFrame(const tPose<2, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const
+{
+  const TElement yaw = reference.Yaw().Value().Value();
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+
+  const TElement x = this->X().Value() - reference.X().Value();
+  const TElement y = this->Y().Value() - reference.Y().Value();
+  tPose pose(*this);
+  pose.Set(cos_yaw * x + sin_yaw * y, cos_yaw * y - sin_yaw * x, tOrientationComponent<>(this->Yaw().Value().Value() - yaw));
+  return pose;
+}
+
+//----------------------------------------------------------------------
+// tPose2D Invert
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Invert()
+{
+  const TElement yaw = this->Yaw().Value().Value();
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+
+  const TElement x = this->X().Value();
+  const TElement y = this->Y().Value();
+  this->Set(-cos_yaw * x - sin_yaw * y, sin_yaw * x - cos_yaw * y, tOrientationComponent<>(-yaw));
+}
+
+//----------------------------------------------------------------------
+// tPose2D Inverted
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Inverted() const
+{
+  tPose temp(*this);
+  temp.Invert();
+  return temp;
+}
+
 //----------------------------------------------------------------------
 // tPose2D GetEuclideanNorm
 //----------------------------------------------------------------------
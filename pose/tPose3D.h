@@ -221,6 +221,31 @@ public:
   template <typename TRoll, typename TPitch, typename TYaw>
   tPose Rotated(TRoll roll, TPitch pitch, TYaw yaw) const;
 
+  //! Concatenate a relative transformation to this pose.
+  /*! The relative transformation is given in the local frame of this pose.
+   *  The result is computed in closed form without building intermediate
+   *  math::tMatrix objects or running the generic roll/pitch/yaw extraction.
+   *  Like the product of the transformation matrices, the orientation becomes
+   *  R * R_rel. Until the closed form was introduced it was R_rel * R, which
+   *  differs from the matrix product if this pose has non-zero roll or pitch.
+   *  \param relative_transformation The transformation to apply.
+   */
+  template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
+  void ApplyRelativePoseTransformation(const tPose<3, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation);
+
+  //! Get this pose relative to the given reference pose.
+  /*! Uses the rigid transformation inverse of the reference, i.e. its
+   *  transposed rotation, instead of a general matrix inverse.
+   *  \param reference The pose this pose is expressed relative to.
+   */
+  template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
+  tPose GetPoseInLocalFrame(const tPose<3, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const;
+
+  //! Replace this pose by its inverse rigid transformation.
+  void Invert();
+
+  tPose Inverted() const;
+
   TElement GetEuclideanNorm() const;
 
 };
@@ -151,6 +151,101 @@ tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose<3
   return temp;
 }
 
+//----------------------------------------------------------------------
+// tPose3D ApplyRelativePoseTransformation
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
+void tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tPose<3, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation)
+{
+  TElement rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(rotation, this->Roll().Value().Value(), this->Pitch().Value().Value(), this->Yaw().Value().Value());
+  TElement relative_rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(relative_rotation, relative_transformation.Roll().Value().Value(), relative_transformation.Pitch().Value().Value(), relative_transformation.Yaw().Value().Value());
+
+  const TElement x = relative_transformation.X().Value();
+  const TElement y = relative_transformation.Y().Value();
+  const TElement z = relative_transformation.Z().Value();
+  this->SetPosition(this->X().Value() + rotation[0][0] * x + rotation[0][1] * y + rotation[0][2] * z,
+                    this->Y().Value() + rotation[1][0] * x + rotation[1][1] * y + rotation[1][2] * z,
+                    this->Z().Value() + rotation[2][0] * x + rotation[2][1] * y + rotation[2][2] * z);
+
+  TElement result[3][3];
+  orientation::Multiply(result, rotation, relative_rotation);
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(result, roll, pitch, yaw);
+  this->SetOrientation(tOrientationComponent<>(roll), tOrientationComponent<>(pitch), tOrientationComponent<>(yaw));
+}
+
+//----------------------------------------------------------------------
+// tPose3D GetPoseInLocalFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
+tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::GetPoseInLocalFrame(const tPose<3, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const
+{
+  TElement rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(rotation, this->Roll().Value().Value(), this->Pitch().Value().Value(), this->Yaw().Value().Value());
+  TElement reference_rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(reference_rotation, reference.Roll().Value().Value(), reference.Pitch().Value().Value(), reference.Yaw().Value().Value());
+
+  const TElement offset[3] = { this->X().Value() - reference.X().Value(), this->Y().Value() - reference.Y().Value(), this->Z().Value() - reference.Z().Value() };
+  TElement local_position[3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    local_position[i] = reference_rotation[0][i] * offset[0] + reference_rotation[1][i] * offset[1] + reference_rotation[2][i] * offset[2];
+  }
+
+  TElement local_rotation[3][3];
+  orientation::MultiplyTransposed(local_rotation, reference_rotation, rotation);
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(local_rotation, roll, pitch, yaw);
+
+  tPose pose(*this);
+  pose.Set(local_position[0], local_position[1], local_position[2], tOrientationComponent<>(roll), tOrientationComponent<>(pitch), tOrientationComponent<>(yaw));
+  return pose;
+}
+
+//----------------------------------------------------------------------
+// tPose3D Invert
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Invert()
+{
+  TElement rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(rotation, this->Roll().Value().Value(), this->Pitch().Value().Value(), this->Yaw().Value().Value());
+
+  const TElement x = this->X().Value();
+  const TElement y = this->Y().Value();
+  const TElement z = this->Z().Value();
+  this->SetPosition(-(rotation[0][0] * x + rotation[1][0] * y + rotation[2][0] * z),
+                    -(rotation[0][1] * x + rotation[1][1] * y + rotation[2][1] * z),
+                    -(rotation[0][2] * x + rotation[1][2] * y + rotation[2][2] * z));
+
+  TElement transposed[3][3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      transposed[i][j] = rotation[j][i];
+    }
+  }
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(transposed, roll, pitch, yaw);
+  this->SetOrientation(tOrientationComponent<>(roll), tOrientationComponent<>(pitch), tOrientationComponent<>(yaw));
+}
+
+//----------------------------------------------------------------------
+// tPose3D Inverted
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Inverted() const
+{
+  tPose temp(*this);
+  temp.Invert();
+  return temp;
+}
+
 //----------------------------------------------------------------------
 // tPose3D GetEuclideanNorm
 //----------------------------------------------------------------------
@@ -0,0 +1,151 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPoseArray2D.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tPoseArray2D
+ *
+ * \b tPoseArray2D
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__tPoseArray2D_h__
+#define __rrlib__localization__pose__tPoseArray2D_h__
+
+#include "rrlib/localization/pose/tPoseArrayBase.h"
+#include "rrlib/localization/pose/tPose2D.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Structure of arrays for many poses in the two dimensional case.
+/*! The lanes X, Y and Yaw hold raw values in meters and radians.
+ *  The kernels work directly on the lanes in plain loops. Those that
+ *  do not need per element trigonometry, e.g. GetPosesInLocalFrame
+ *  or GetDistances, are vectorised by the compiler.
+ */
+template <typename TElement, typename TAutoWrapPolicy>
+class tPoseArray<2, TElement, TAutoWrapPolicy> : public pose::tPoseArrayBase<2, TElement, TAutoWrapPolicy>
+{
+  typedef pose::tPoseArrayBase<2, TElement, TAutoWrapPolicy> tPoseArrayBase;
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef typename tPoseArrayBase::tValue tValue;
+
+  using tPoseArrayBase::tPoseArrayBase;
+
+  inline const TElement *X() const
+  {
+    return this->Lane(0);
+  }
+  inline TElement *X()
+  {
+    return this->Lane(0);
+  }
+  inline const TElement *Y() const
+  {
+    return this->Lane(1);
+  }
+  inline TElement *Y()
+  {
+    return this->Lane(1);
+  }
+  inline const TElement *Yaw() const
+  {
+    return this->Lane(2);
+  }
+  inline TElement *Yaw()
+  {
+    return this->Lane(2);
+  }
+
+  tValue Get(size_t index) const;
+
+  void Set(size_t index, const tValue &pose);
+
+  //! Concatenate the same relative transformation to every pose
+  void ApplyRelativePoseTransformation(const tValue &relative_transformation);
+
+  //! Concatenate the element with the same index of relative_transformations to every pose
+  void ApplyRelativePoseTransformation(const tPoseArray &relative_transformations);
+
+  //! Replace every pose by its inverse rigid transformation
+  void Invert();
+
+  //! Express every pose relative to reference
+  /*! \param reference The pose that defines the local frame
+   *  \param result    Is resized to hold the results and may be this array
+   */
+  void GetPosesInLocalFrame(const tValue &reference, tPoseArray &result) const;
+
+  //! Compute the euclidean distances of all positions to the given one
+  /*! \param position  The position to measure from
+   *  \param distances Storage for Size() values
+   */
+  void GetDistances(const tPosition<2, TElement, si_units::tMeter> &position, TElement *distances) const;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/pose/tPoseArray2D.hpp"
+
+#endif
@@ -0,0 +1,208 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPoseArray2D.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tPoseArray2D Get
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+typename tPoseArray<2, TElement, TAutoWrapPolicy>::tValue tPoseArray<2, TElement, TAutoWrapPolicy>::Get(size_t index) const
+{
+  assert(index < this->Size());
+  return tValue(this->X()[index], this->Y()[index], typename tValue::template tOrientationComponent<>(this->Yaw()[index]));
+}
+
+//----------------------------------------------------------------------
+// tPoseArray2D Set
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<2, TElement, TAutoWrapPolicy>::Set(size_t index, const tValue &pose)
+{
+  assert(index < this->Size());
+  this->X()[index] = pose.X().Value();
+  this->Y()[index] = pose.Y().Value();
+  this->Yaw()[index] = pose.Yaw().Value().Value();
+}
+
+//----------------------------------------------------------------------
+// tPoseArray2D ApplyRelativePoseTransformation
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<2, TElement, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tValue &relative_transformation)
+{
+  const TElement relative_x = relative_transformation.X().Value();
+  const TElement relative_y = relative_transformation.Y().Value();
+  const TElement relative_yaw = relative_transformation.Yaw().Value().Value();
+  TElement *x = this->X();
+  TElement *y = this->Y();
+  TElement *yaw = this->Yaw();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    const TElement sin_yaw = std::sin(yaw[i]);
+    const TElement cos_yaw = std::cos(yaw[i]);
+    x[i] += cos_yaw * relative_x - sin_yaw * relative_y;
+    y[i] += sin_yaw * relative_x + cos_yaw * relative_y;
+    yaw[i] = this->Wrap(yaw[i] + relative_yaw);
+  }
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<2, TElement, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tPoseArray &relative_transformations)
+{
+  assert(relative_transformations.Size() == this->Size());
+  const TElement *relative_x = relative_transformations.X();
+  const TElement *relative_y = relative_transformations.Y();
+  const TElement *relative_yaw = relative_transformations.Yaw();
+  TElement *x = this->X();
+  TElement *y = this->Y();
+  TElement *yaw = this->Yaw();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    const TElement sin_yaw = std::sin(yaw[i]);
+    const TElement cos_yaw = std::cos(yaw[i]);
+    x[i] += cos_yaw * relative_x[i] - sin_yaw * relative_y[i];
+    y[i] += sin_yaw * relative_x[i] + cos_yaw * relative_y[i];
+    yaw[i] = this->Wrap(yaw[i] + relative_yaw[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArray2D Invert
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<2, TElement, TAutoWrapPolicy>::Invert()
+{
+  TElement *x = this->X();
+  TElement *y = this->Y();
+  TElement *yaw = this->Yaw();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    const TElement sin_yaw = std::sin(yaw[i]);
+    const TElement cos_yaw = std::cos(yaw[i]);
+    const TElement old_x = x[i];
+    x[i] = -cos_yaw * old_x - sin_yaw * y[i];
+    y[i] = sin_yaw * old_x - cos_yaw * y[i];
+    yaw[i] = this->Wrap(-yaw[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArray2D GetPosesInLocalFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<2, TElement, TAutoWrapPolicy>::GetPosesInLocalFrame(const tValue &reference, tPoseArray &result) const
+{
+  const TElement reference_yaw = reference.Yaw().Value().Value();
+  const TElement sin_yaw = std::sin(reference_yaw);
+  const TElement cos_yaw = std::cos(reference_yaw);
+  const TElement reference_x = reference.X().Value();
+  const TElement reference_y = reference.Y().Value();
+
+  const size_t size = this->Size();
+  result.Resize(size);
+  const TElement *x = this->X();
+  const TElement *y = this->Y();
+  const TElement *yaw = this->Yaw();
+  TElement *result_x = result.X();
+  TElement *result_y = result.Y();
+  TElement *result_yaw = result.Yaw();
+  for (size_t i = 0; i < size; ++i)
+  {
+    const TElement offset_x = x[i] - reference_x;
+    const TElement offset_y = y[i] - reference_y;
+    result_x[i] = cos_yaw * offset_x + sin_yaw * offset_y;
+    result_y[i] = cos_yaw * offset_y - sin_yaw * offset_x;
+  }
+  for (size_t i = 0; i < size; ++i)
+  {
+    result_yaw[i] = this->Wrap(yaw[i] - reference_yaw);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArray2D GetDistances
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<2, TElement, TAutoWrapPolicy>::GetDistances(const tPosition<2, TElement, si_units::tMeter> &position, TElement *distances) const
+{
+  const TElement position_x = position.X().Value();
+  const TElement position_y = position.Y().Value();
+  const TElement *x = this->X();
+  const TElement *y = this->Y();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    const TElement dx = x[i] - position_x;
+    const TElement dy = y[i] - position_y;
+    distances[i] = std::sqrt(dx * dx + dy * dy);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,265 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPoseArray3D.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tPoseArray3D Get
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+typename tPoseArray<3, TElement, TAutoWrapPolicy>::tValue tPoseArray<3, TElement, TAutoWrapPolicy>::Get(size_t index) const
+{
+  assert(index < this->Size());
+  typedef typename tValue::template tOrientationComponent<> tAngle;
+  return tValue(this->X()[index], this->Y()[index], this->Z()[index], tAngle(this->Roll()[index]), tAngle(this->Pitch()[index]), tAngle(this->Yaw()[index]));
+}
+
+//----------------------------------------------------------------------
+// tPoseArray3D Set
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<3, TElement, TAutoWrapPolicy>::Set(size_t index, const tValue &pose)
+{
+  assert(index < this->Size());
+  this->X()[index] = pose.X().Value();
+  this->Y()[index] = pose.Y().Value();
+  this->Z()[index] = pose.Z().Value();
+  this->Roll()[index] = pose.Roll().Value().Value();
+  this->Pitch()[index] = pose.Pitch().Value().Value();
+  this->Yaw()[index] = pose.Yaw().Value().Value();
+}
+
+//----------------------------------------------------------------------
+// tPoseArray3D ApplyRelativePoseTransformation
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<3, TElement, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tValue &relative_transformation)
+{
+  TElement relative_rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(relative_rotation, relative_transformation.Roll().Value().Value(), relative_transformation.Pitch().Value().Value(), relative_transformation.Yaw().Value().Value());
+  const TElement relative_x = relative_transformation.X().Value();
+  const TElement relative_y = relative_transformation.Y().Value();
+  const TElement relative_z = relative_transformation.Z().Value();
+
+  TElement *x = this->X();
+  TElement *y = this->Y();
+  TElement *z = this->Z();
+  TElement *roll = this->Roll();
+  TElement *pitch = this->Pitch();
+  TElement *yaw = this->Yaw();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    TElement rotation[3][3];
+    orientation::GetRotationMatrix<TElement>(rotation, roll[i], pitch[i], yaw[i]);
+    x[i] += rotation[0][0] * relative_x + rotation[0][1] * relative_y + rotation[0][2] * relative_z;
+    y[i] += rotation[1][0] * relative_x + rotation[1][1] * relative_y + rotation[1][2] * relative_z;
+    z[i] += rotation[2][0] * relative_x + rotation[2][1] * relative_y + rotation[2][2] * relative_z;
+
+    TElement result[3][3];
+    orientation::Multiply(result, rotation, relative_rotation);
+    orientation::ExtractRollPitchYaw(result, roll[i], pitch[i], yaw[i]);
+  }
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<3, TElement, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tPoseArray &relative_transformations)
+{
+  assert(relative_transformations.Size() == this->Size());
+  const TElement *relative_x = relative_transformations.X();
+  const TElement *relative_y = relative_transformations.Y();
+  const TElement *relative_z = relative_transformations.Z();
+  const TElement *relative_roll = relative_transformations.Roll();
+  const TElement *relative_pitch = relative_transformations.Pitch();
+  const TElement *relative_yaw = relative_transformations.Yaw();
+
+  TElement *x = this->X();
+  TElement *y = this->Y();
+  TElement *z = this->Z();
+  TElement *roll = this->Roll();
+  TElement *pitch = this->Pitch();
+  TElement *yaw = this->Yaw();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    TElement rotation[3][3];
+    orientation::GetRotationMatrix<TElement>(rotation, roll[i], pitch[i], yaw[i]);
+    TElement relative_rotation[3][3];
+    orientation::GetRotationMatrix<TElement>(relative_rotation, relative_roll[i], relative_pitch[i], relative_yaw[i]);
+    x[i] += rotation[0][0] * relative_x[i] + rotation[0][1] * relative_y[i] + rotation[0][2] * relative_z[i];
+    y[i] += rotation[1][0] * relative_x[i] + rotation[1][1] * relative_y[i] + rotation[1][2] * relative_z[i];
+    z[i] += rotation[2][0] * relative_x[i] + rotation[2][1] * relative_y[i] + rotation[2][2] * relative_z[i];
+
+    TElement result[3][3];
+    orientation::Multiply(result, rotation, relative_rotation);
+    orientation::ExtractRollPitchYaw(result, roll[i], pitch[i], yaw[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArray3D Invert
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<3, TElement, TAutoWrapPolicy>::Invert()
+{
+  TElement *x = this->X();
+  TElement *y = this->Y();
+  TElement *z = this->Z();
+  TElement *roll = this->Roll();
+  TElement *pitch = this->Pitch();
+  TElement *yaw = this->Yaw();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    TElement rotation[3][3];
+    orientation::GetRotationMatrix<TElement>(rotation, roll[i], pitch[i], yaw[i]);
+    const TElement old_x = x[i];
+    const TElement old_y = y[i];
+    const TElement old_z = z[i];
+    x[i] = -(rotation[0][0] * old_x + rotation[1][0] * old_y + rotation[2][0] * old_z);
+    y[i] = -(rotation[0][1] * old_x + rotation[1][1] * old_y + rotation[2][1] * old_z);
+    z[i] = -(rotation[0][2] * old_x + rotation[1][2] * old_y + rotation[2][2] * old_z);
+
+    TElement transposed[3][3];
+    for (size_t j = 0; j < 3; ++j)
+    {
+      for (size_t k = 0; k < 3; ++k)
+      {
+        transposed[j][k] = rotation[k][j];
+      }
+    }
+    orientation::ExtractRollPitchYaw(transposed, roll[i], pitch[i], yaw[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArray3D GetPosesInLocalFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<3, TElement, TAutoWrapPolicy>::GetPosesInLocalFrame(const tValue &reference, tPoseArray &result) const
+{
+  TElement reference_rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(reference_rotation, reference.Roll().Value().Value(), reference.Pitch().Value().Value(), reference.Yaw().Value().Value());
+  const TElement reference_x = reference.X().Value();
+  const TElement reference_y = reference.Y().Value();
+  const TElement reference_z = reference.Z().Value();
+
+  const size_t size = this->Size();
+  result.Resize(size);
+  const TElement *x = this->X();
+  const TElement *y = this->Y();
+  const TElement *z = this->Z();
+  const TElement *roll = this->Roll();
+  const TElement *pitch = this->Pitch();
+  const TElement *yaw = this->Yaw();
+  TElement *result_x = result.X();
+  TElement *result_y = result.Y();
+  TElement *result_z = result.Z();
+  TElement *result_roll = result.Roll();
+  TElement *result_pitch = result.Pitch();
+  TElement *result_yaw = result.Yaw();
+  for (size_t i = 0; i < size; ++i)
+  {
+    const TElement offset_x = x[i] - reference_x;
+    const TElement offset_y = y[i] - reference_y;
+    const TElement offset_z = z[i] - reference_z;
+    result_x[i] = reference_rotation[0][0] * offset_x + reference_rotation[1][0] * offset_y + reference_rotation[2][0] * offset_z;
+    result_y[i] = reference_rotation[0][1] * offset_x + reference_rotation[1][1] * offset_y + reference_rotation[2][1] * offset_z;
+    result_z[i] = reference_rotation[0][2] * offset_x + reference_rotation[1][2] * offset_y + reference_rotation[2][2] * offset_z;
+  }
+  for (size_t i = 0; i < size; ++i)
+  {
+    TElement rotation[3][3];
+    orientation::GetRotationMatrix<TElement>(rotation, roll[i], pitch[i], yaw[i]);
+    TElement local_rotation[3][3];
+    orientation::MultiplyTransposed(local_rotation, reference_rotation, rotation);
+    orientation::ExtractRollPitchYaw(local_rotation, result_roll[i], result_pitch[i], result_yaw[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArray3D GetDistances
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseArray<3, TElement, TAutoWrapPolicy>::GetDistances(const tPosition<3, TElement, si_units::tMeter> &position, TElement *distances) const
+{
+  const TElement position_x = position.X().Value();
+  const TElement position_y = position.Y().Value();
+  const TElement position_z = position.Z().Value();
+  const TElement *x = this->X();
+  const TElement *y = this->Y();
+  const TElement *z = this->Z();
+  const size_t size = this->Size();
+  for (size_t i = 0; i < size; ++i)
+  {
+    const TElement dx = x[i] - position_x;
+    const TElement dy = y[i] - position_y;
+    const TElement dz = z[i] - position_z;
+    distances[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
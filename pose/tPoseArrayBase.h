@@ -0,0 +1,271 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPoseArrayBase.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tPoseArrayBase
+ *
+ * \b tPoseArrayBase
+ *
+ * Common storage of \ref tPoseArray: a structure of arrays with one
+ * aligned lane of raw values (meters and radians) per pose component.
+ * Single elements are exchanged as \ref tPose values, so existing code
+ * can consume them.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__tPoseArrayBase_h__
+#define __rrlib__localization__pose__tPoseArrayBase_h__
+
+#include "rrlib/localization/pose/tPoseBase.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+class tPoseArray;
+
+namespace pose
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+//! Alignment of the lanes in bytes, which suffices for AVX loads
+const size_t cPOSE_ARRAY_ALIGNMENT = 32;
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Allocator that places the lanes of tPoseArray on cPOSE_ARRAY_ALIGNMENT boundaries
+template <typename T>
+struct tAlignedAllocator
+{
+  typedef T value_type;
+
+  template <typename U>
+  struct rebind
+  {
+    typedef tAlignedAllocator<U> other;
+  };
+
+  tAlignedAllocator() = default;
+
+  template <typename U>
+  tAlignedAllocator(const tAlignedAllocator<U> &)
+  {}
+
+  T *allocate(size_t n)
+  {
+    void *memory = nullptr;
+    if (posix_memalign(&memory, cPOSE_ARRAY_ALIGNMENT, n * sizeof(T)) != 0)
+    {
+      throw std::bad_alloc();
+    }
+    return static_cast<T *>(memory);
+  }
+
+  void deallocate(T *memory, size_t)
+  {
+    free(memory);
+  }
+};
+
+template <typename T, typename U>
+inline bool operator == (const tAlignedAllocator<T> &, const tAlignedAllocator<U> &)
+{
+  return true;
+}
+
+template <typename T, typename U>
+inline bool operator != (const tAlignedAllocator<T> &, const tAlignedAllocator<U> &)
+{
+  return false;
+}
+
+//! Common storage of tPoseArray
+/*! Lanes are accessed by index here. The specializations of tPoseArray
+ *  provide named accessors like X() or Yaw() and the kernels.
+ */
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+class tPoseArrayBase
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  //! The number of lanes, i.e. the number of degrees of freedom of a pose
+  static const size_t cLANES = Tdimension == 2 ? 3 : 6;
+
+  typedef TElement tElement;
+
+  //! The type of the single poses stored in the array
+  typedef tPose<Tdimension, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> tValue;
+
+  //! Read only view on the array that yields tValue objects
+  class tConstIterator
+  {
+  public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef tValue value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const tValue *pointer;
+    typedef tValue reference;
+
+    tConstIterator(const tPoseArray<Tdimension, TElement, TAutoWrapPolicy> &array, size_t index) :
+      array(&array),
+      index(index)
+    {}
+    inline tValue operator *() const
+    {
+      return this->array->Get(this->index);
+    }
+    inline tConstIterator &operator ++()
+    {
+      ++this->index;
+      return *this;
+    }
+    inline tConstIterator operator ++(int)
+    {
+      tConstIterator temp(*this);
+      ++this->index;
+      return temp;
+    }
+    inline bool operator == (const tConstIterator &other) const
+    {
+      return this->array == other.array && this->index == other.index;
+    }
+    inline bool operator != (const tConstIterator &other) const
+    {
+      return !(*this == other);
+    }
+  private:
+    const tPoseArray<Tdimension, TElement, TAutoWrapPolicy> *array;
+    size_t index;
+  };
+
+  tPoseArrayBase();
+
+  explicit tPoseArrayBase(size_t size);
+
+  inline size_t Size() const
+  {
+    return this->lanes[0].size();
+  }
+
+  void Resize(size_t size);
+
+  void Reserve(size_t capacity);
+
+  void Clear();
+
+  void PushBack(const tValue &pose);
+
+  inline tValue operator[](size_t index) const
+  {
+    return reinterpret_cast<const tPoseArray<Tdimension, TElement, TAutoWrapPolicy> *>(this)->Get(index);
+  }
+
+  inline tConstIterator begin() const
+  {
+    return tConstIterator(*reinterpret_cast<const tPoseArray<Tdimension, TElement, TAutoWrapPolicy> *>(this), 0);
+  }
+  inline tConstIterator end() const
+  {
+    return tConstIterator(*reinterpret_cast<const tPoseArray<Tdimension, TElement, TAutoWrapPolicy> *>(this), this->Size());
+  }
+
+  //! Direct access to the raw values of a lane
+  inline const TElement *Lane(size_t lane) const
+  {
+    return this->lanes[lane].data();
+  }
+  inline TElement *Lane(size_t lane)
+  {
+    return this->lanes[lane].data();
+  }
+
+//----------------------------------------------------------------------
+// Protected methods
+//----------------------------------------------------------------------
+protected:
+
+  //! Apply the auto wrap policy of the array to a raw angle in radian
+  static inline TElement Wrap(TElement angle)
+  {
+    return math::tAngle<TElement, math::angle::Radian, TAutoWrapPolicy>(angle).Value();
+  }
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  std::vector<TElement, tAlignedAllocator<TElement>> lanes[cLANES];
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
+
+#include "rrlib/localization/pose/tPoseArrayBase.hpp"
+
+#endif
@@ -0,0 +1,133 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPoseArrayBase.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+namespace pose
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+const size_t tPoseArrayBase<Tdimension, TElement, TAutoWrapPolicy>::cLANES;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tPoseArrayBase constructors
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+tPoseArrayBase<Tdimension, TElement, TAutoWrapPolicy>::tPoseArrayBase()
+{}
+
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+tPoseArrayBase<Tdimension, TElement, TAutoWrapPolicy>::tPoseArrayBase(size_t size)
+{
+  this->Resize(size);
+}
+
+//----------------------------------------------------------------------
+// tPoseArrayBase Resize
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+void tPoseArrayBase<Tdimension, TElement, TAutoWrapPolicy>::Resize(size_t size)
+{
+  for (size_t i = 0; i < cLANES; ++i)
+  {
+    this->lanes[i].resize(size);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArrayBase Reserve
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+void tPoseArrayBase<Tdimension, TElement, TAutoWrapPolicy>::Reserve(size_t capacity)
+{
+  for (size_t i = 0; i < cLANES; ++i)
+  {
+    this->lanes[i].reserve(capacity);
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArrayBase Clear
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+void tPoseArrayBase<Tdimension, TElement, TAutoWrapPolicy>::Clear()
+{
+  for (size_t i = 0; i < cLANES; ++i)
+  {
+    this->lanes[i].clear();
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseArrayBase PushBack
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TAutoWrapPolicy>
+void tPoseArrayBase<Tdimension, TElement, TAutoWrapPolicy>::PushBack(const tValue &pose)
+{
+  const size_t index = this->Size();
+  this->Resize(index + 1);
+  reinterpret_cast<tPoseArray<Tdimension, TElement, TAutoWrapPolicy> *>(this)->Set(index, pose);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
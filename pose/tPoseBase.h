@@ -171,9 +171,6 @@ public:
   template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
   tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> GetPoseInParentFrame(const tPose<Tdimension, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const;
 
-  template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
-  tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> GetPoseInLocalFrame(const tPose<Tdimension, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const;
-
   template <typename TTranslationElement>
   void Translate(const math::tVector<Tdimension, TTranslationElement> &translation);
 
@@ -192,9 +189,6 @@ public:
   template <typename TFactor>
   tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> Scaled(TFactor factor) const;
 
-  template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
-  void ApplyRelativePoseTransformation(const tPose<Tdimension, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation);
-
   bool IsZero(double epsilon = 1E-6) const;
 
 //----------------------------------------------------------------------
@@ -221,6 +215,13 @@ tPose < Tdimension, decltype(TLeftElement() - TRightElement()), TPositionSIUnit,
 
 // Note: there is no operator * here on purpose, as this operation is hard to define generally. If you need this operator, implement it for your specific pose.
 
+//! The number of raw values of a pose, for use in constant expressions
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+constexpr size_t GetNumberOfPoseValues(const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> *)
+{
+  return Tdimension == 2 ? 3 : 6;
+}
+
 template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
 bool operator == (const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &left, const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &right);
 
@@ -197,18 +197,9 @@ template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
 tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPoseBase<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::GetPoseInParentFrame(const tPose<Tdimension, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const
 {
   typedef tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose;
-  return tPose(reference.GetTransformationMatrix() * reinterpret_cast<const tPose *>(this)->GetTransformationMatrix());
-}
-
-//----------------------------------------------------------------------
-// tPoseBase GetPoseInLocalFrame
-//----------------------------------------------------------------------
-template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
-template <typename TReferenceElement, typename TReferenceAutoWrapPolicy>
-tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPoseBase<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::GetPoseInLocalFrame(const tPose<Tdimension, TReferenceElement, TPositionSIUnit, TOrientationSIUnit, TReferenceAutoWrapPolicy> &reference) const
-{
-  typedef tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose;
-  return tPose(reference.GetTransformationMatrix().Inverse() * reinterpret_cast<const tPose *>(this)->GetTransformationMatrix());
+  tPose pose(reference);
+  pose.ApplyRelativePoseTransformation(*reinterpret_cast<const tPose *>(this));
+  return pose;
 }
 
 //----------------------------------------------------------------------
@@ -280,17 +271,6 @@ tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy
   return temp;
 }
 
-//----------------------------------------------------------------------
-// tPoseBase ApplyRelativePoseTransformation
-//----------------------------------------------------------------------
-template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
-template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
-void tPoseBase<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tPose<Tdimension, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation)
-{
-  this->Translate(this->Orientation().GetMatrix() * relative_transformation.Position());
-  this->Rotate(relative_transformation.Orientation().GetMatrix());
-}
-
 //----------------------------------------------------------------------
 // tPoseBase IsZero
 //----------------------------------------------------------------------
@@ -0,0 +1,290 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPoseWithCache.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tPoseWithCache
+ *
+ * \b tPoseWithCache
+ *
+ * A \ref tPose3D that lazily keeps the rotation matrix of its
+ * orientation. Poses that are used as reference frame for many
+ * conversions per cycle, e.g. sensor mountings or the current robot
+ * pose, then evaluate sine and cosine of their angles only once after
+ * each change of the orientation.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__tPoseWithCache_h__
+#define __rrlib__localization__pose__tPoseWithCache_h__
+
+#include "rrlib/localization/pose/tPose3D.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <iostream>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A three dimensional pose that caches the rotation matrix of its orientation
+/*! The orientation is only accessible for reading. All modifications go
+ *  through the setters of this class, which invalidate the cache. The
+ *  position does not take part in the cache and can be modified freely.
+ *
+ *  The cache is updated by const methods. Hence, an object must not be
+ *  read from several threads without synchronization.
+ */
+template <typename TElement = double, typename TAutoWrapPolicy = math::angle::Signed>
+class tPoseWithCache
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+
+  //! The type of the wrapped pose
+  typedef tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> tValue;
+
+  //! The data type used to represent a single component of the position.
+  typedef typename tValue::template tPositionComponent<> tPositionComponent;
+
+  //! The data type used to represent a single component of the orientation.
+  typedef typename tValue::template tOrientationComponent<> tOrientationComponent;
+
+  tPoseWithCache();
+
+  tPoseWithCache(const tValue &pose);
+
+  template <typename TX, typename TY, typename TZ, typename TRoll, typename TPitch, typename TYaw>
+  tPoseWithCache(TX x, TY y, TZ z, TRoll roll, TPitch pitch, TYaw yaw);
+
+  tPoseWithCache &operator = (const tValue &pose);
+
+  //! Get the wrapped pose
+  inline const tValue &Pose() const
+  {
+    return this->pose;
+  }
+  inline operator const tValue &() const
+  {
+    return this->pose;
+  }
+
+  inline const tPosition3D<TElement> &Position() const
+  {
+    return this->pose.Position();
+  }
+  inline tPosition3D<TElement> &Position()
+  {
+    return this->pose.Position();
+  }
+
+  inline const typename tValue::template tOrientation<> &Orientation() const
+  {
+    return this->pose.Orientation();
+  }
+
+  //! Get the x component of the position.
+  inline const tPositionComponent &X() const
+  {
+    return this->pose.X();
+  }
+  //! Get/Set the x component of the position.
+  inline tPositionComponent &X()
+  {
+    return this->pose.X();
+  }
+
+  //! Get the y component of the position.
+  inline const tPositionComponent &Y() const
+  {
+    return this->pose.Y();
+  }
+  //! Get/Set the y component of the position.
+  inline tPositionComponent &Y()
+  {
+    return this->pose.Y();
+  }
+
+  //! Get the z component of the position.
+  inline const tPositionComponent &Z() const
+  {
+    return this->pose.Z();
+  }
+  //! Get/Set the z component of the position.
+  inline tPositionComponent &Z()
+  {
+    return this->pose.Z();
+  }
+
+  //! Get the roll component of the orientation.
+  inline const tOrientationComponent &Roll() const
+  {
+    return this->pose.Roll();
+  }
+  //! Get the pitch component of the orientation.
+  inline const tOrientationComponent &Pitch() const
+  {
+    return this->pose.Pitch();
+  }
+  //! Get the yaw component of the orientation.
+  inline const tOrientationComponent &Yaw() const
+  {
+    return this->pose.Yaw();
+  }
+
+  //! Set the roll component of the orientation and invalidate the cache.
+  template <typename TRoll>
+  void SetRoll(TRoll roll);
+
+  //! Set the pitch component of the orientation and invalidate the cache.
+  template <typename TPitch>
+  void SetPitch(TPitch pitch);
+
+  //! Set the yaw component of the orientation and invalidate the cache.
+  template <typename TYaw>
+  void SetYaw(TYaw yaw);
+
+  template <typename TX, typename TY, typename TZ>
+  void SetPosition(TX x, TY y, TZ z);
+
+  template <typename TRoll, typename TPitch, typename TYaw>
+  void SetOrientation(TRoll roll, TPitch pitch, TYaw yaw);
+
+  template <typename TX, typename TY, typename TZ, typename TRoll, typename TPitch, typename TYaw>
+  void Set(TX x, TY y, TZ z, TRoll roll, TPitch pitch, TYaw yaw);
+
+  void Reset();
+
+  template <typename TRoll, typename TPitch, typename TYaw>
+  void Rotate(TRoll roll, TPitch pitch, TYaw yaw);
+
+  //! Get the rotation matrix of the orientation
+  /*! It is computed on the first call after the orientation was changed.
+   */
+  inline const TElement(&RotationMatrix() const)[3][3]
+  {
+    if (!this->rotation_valid)
+    {
+      this->UpdateRotationMatrix();
+    }
+    return this->rotation;
+  }
+
+  math::tMatrix<4, 4, TElement> GetTransformationMatrix() const;
+
+  //! Concatenate a relative transformation to this pose.
+  /*! The resulting rotation matrix stays in the cache, so that the next
+   *  conversion does not need to evaluate trigonometric functions.
+   *  \param relative_transformation The transformation to apply.
+   */
+  void ApplyRelativePoseTransformation(const tValue &relative_transformation);
+
+  //! Get this pose in the parent frame of reference
+  tValue GetPoseInParentFrame(const tPoseWithCache &reference) const;
+
+  //! Get this pose relative to reference
+  tValue GetPoseInLocalFrame(const tPoseWithCache &reference) const;
+
+  //! Transform a position given relative to this pose into the parent frame
+  tPosition3D<TElement> TransformToParentFrame(const tPosition3D<TElement> &position) const;
+
+  //! Express a position given in the parent frame relative to this pose
+  tPosition3D<TElement> TransformToLocalFrame(const tPosition3D<TElement> &position) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tValue pose;
+  mutable TElement rotation[3][3];
+  mutable bool rotation_valid;
+
+  void UpdateRotationMatrix() const;
+
+};
+
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool IsEqual(const tPoseWithCache<TElement, TAutoWrapPolicy> &left, const tPoseWithCache<TElement, TAutoWrapPolicy> &right, float max_error = 1E-6, math::tFloatComparisonMethod method = math::eFCM_ABSOLUTE_ERROR);
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator == (const tPoseWithCache<TElement, TAutoWrapPolicy> &left, const tPoseWithCache<TElement, TAutoWrapPolicy> &right);
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator != (const tPoseWithCache<TElement, TAutoWrapPolicy> &left, const tPoseWithCache<TElement, TAutoWrapPolicy> &right);
+
+template <typename TElement, typename TAutoWrapPolicy>
+std::ostream &operator << (std::ostream &stream, const tPoseWithCache<TElement, TAutoWrapPolicy> &pose);
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tPoseWithCache<TElement, TAutoWrapPolicy> &pose);
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tPoseWithCache<TElement, TAutoWrapPolicy> &pose);
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/pose/tPoseWithCache.hpp"
+
+#endif
@@ -0,0 +1,357 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tPoseWithCache.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tPoseWithCache constructors
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tPoseWithCache<TElement, TAutoWrapPolicy>::tPoseWithCache() :
+  rotation_valid(false)
+{}
+
+template <typename TElement, typename TAutoWrapPolicy>
+tPoseWithCache<TElement, TAutoWrapPolicy>::tPoseWithCache(const tValue &pose) :
+  pose(pose),
+  rotation_valid(false)
+{}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TX, typename TY, typename TZ, typename TRoll, typename TPitch, typename TYaw>
+tPoseWithCache<TElement, TAutoWrapPolicy>::tPoseWithCache(TX x, TY y, TZ z, TRoll roll, TPitch pitch, TYaw yaw) :
+  pose(x, y, z, roll, pitch, yaw),
+  rotation_valid(false)
+{}
+
+//----------------------------------------------------------------------
+// tPoseWithCache operator =
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tPoseWithCache<TElement, TAutoWrapPolicy> &tPoseWithCache<TElement, TAutoWrapPolicy>::operator = (const tValue &pose)
+{
+  this->pose = pose;
+  this->rotation_valid = false;
+  return *this;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache SetRoll
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TRoll>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::SetRoll(TRoll roll)
+{
+  this->pose.Roll() = tOrientationComponent(roll);
+  this->rotation_valid = false;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache SetPitch
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TPitch>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::SetPitch(TPitch pitch)
+{
+  this->pose.Pitch() = tOrientationComponent(pitch);
+  this->rotation_valid = false;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache SetYaw
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TYaw>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::SetYaw(TYaw yaw)
+{
+  this->pose.Yaw() = tOrientationComponent(yaw);
+  this->rotation_valid = false;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache SetPosition
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TX, typename TY, typename TZ>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::SetPosition(TX x, TY y, TZ z)
+{
+  this->pose.SetPosition(x, y, z);
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache SetOrientation
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TRoll, typename TPitch, typename TYaw>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::SetOrientation(TRoll roll, TPitch pitch, TYaw yaw)
+{
+  this->pose.SetOrientation(roll, pitch, yaw);
+  this->rotation_valid = false;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache Set
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TX, typename TY, typename TZ, typename TRoll, typename TPitch, typename TYaw>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::Set(TX x, TY y, TZ z, TRoll roll, TPitch pitch, TYaw yaw)
+{
+  this->pose.Set(x, y, z, roll, pitch, yaw);
+  this->rotation_valid = false;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache Reset
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::Reset()
+{
+  this->pose.Reset();
+  this->rotation_valid = false;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache Rotate
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TRoll, typename TPitch, typename TYaw>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::Rotate(TRoll roll, TPitch pitch, TYaw yaw)
+{
+  this->pose.Rotate(roll, pitch, yaw);
+  this->rotation_valid = false;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache UpdateRotationMatrix
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::UpdateRotationMatrix() const
+{
+  orientation::GetRotationMatrix<TElement>(this->rotation, this->pose.Roll().Value().Value(), this->pose.Pitch().Value().Value(), this->pose.Yaw().Value().Value());
+  this->rotation_valid = true;
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache GetTransformationMatrix
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+math::tMatrix<4, 4, TElement> tPoseWithCache<TElement, TAutoWrapPolicy>::GetTransformationMatrix() const
+{
+  const TElement(&rotation)[3][3] = this->RotationMatrix();
+  return math::tMatrix<4, 4, TElement>(rotation[0][0], rotation[0][1], rotation[0][2], this->X().Value(),
+                                       rotation[1][0], rotation[1][1], rotation[1][2], this->Y().Value(),
+                                       rotation[2][0], rotation[2][1], rotation[2][2], this->Z().Value(),
+                                       0, 0, 0, 1);
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache ApplyRelativePoseTransformation
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tPoseWithCache<TElement, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tValue &relative_transformation)
+{
+  const TElement(&rotation)[3][3] = this->RotationMatrix();
+  TElement relative_rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(relative_rotation, relative_transformation.Roll().Value().Value(), relative_transformation.Pitch().Value().Value(), relative_transformation.Yaw().Value().Value());
+
+  const TElement x = relative_transformation.X().Value();
+  const TElement y = relative_transformation.Y().Value();
+  const TElement z = relative_transformation.Z().Value();
+  this->pose.SetPosition(this->X().Value() + rotation[0][0] * x + rotation[0][1] * y + rotation[0][2] * z,
+                         this->Y().Value() + rotation[1][0] * x + rotation[1][1] * y + rotation[1][2] * z,
+                         this->Z().Value() + rotation[2][0] * x + rotation[2][1] * y + rotation[2][2] * z);
+
+  TElement result[3][3];
+  orientation::Multiply(result, rotation, relative_rotation);
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(result, roll, pitch, yaw);
+  this->pose.SetOrientation(tOrientationComponent(roll), tOrientationComponent(pitch), tOrientationComponent(yaw));
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      this->rotation[i][j] = result[i][j];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache GetPoseInParentFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+typename tPoseWithCache<TElement, TAutoWrapPolicy>::tValue tPoseWithCache<TElement, TAutoWrapPolicy>::GetPoseInParentFrame(const tPoseWithCache &reference) const
+{
+  const TElement(&rotation)[3][3] = this->RotationMatrix();
+  const TElement(&reference_rotation)[3][3] = reference.RotationMatrix();
+  const tPosition3D<TElement> position = reference.TransformToParentFrame(this->Position());
+
+  TElement result[3][3];
+  orientation::Multiply(result, reference_rotation, rotation);
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(result, roll, pitch, yaw);
+  return tValue(position.X(), position.Y(), position.Z(), tOrientationComponent(roll), tOrientationComponent(pitch), tOrientationComponent(yaw));
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache GetPoseInLocalFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+typename tPoseWithCache<TElement, TAutoWrapPolicy>::tValue tPoseWithCache<TElement, TAutoWrapPolicy>::GetPoseInLocalFrame(const tPoseWithCache &reference) const
+{
+  const TElement(&rotation)[3][3] = this->RotationMatrix();
+  const TElement(&reference_rotation)[3][3] = reference.RotationMatrix();
+  const tPosition3D<TElement> position = reference.TransformToLocalFrame(this->Position());
+
+  TElement result[3][3];
+  orientation::MultiplyTransposed(result, reference_rotation, rotation);
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(result, roll, pitch, yaw);
+  return tValue(position.X(), position.Y(), position.Z(), tOrientationComponent(roll), tOrientationComponent(pitch), tOrientationComponent(yaw));
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache TransformToParentFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tPosition3D<TElement> tPoseWithCache<TElement, TAutoWrapPolicy>::TransformToParentFrame(const tPosition3D<TElement> &position) const
+{
+  const TElement(&rotation)[3][3] = this->RotationMatrix();
+  const TElement x = position.X().Value();
+  const TElement y = position.Y().Value();
+  const TElement z = position.Z().Value();
+  return tPosition3D<TElement>(tPositionComponent(this->X().Value() + rotation[0][0] * x + rotation[0][1] * y + rotation[0][2] * z),
+                               tPositionComponent(this->Y().Value() + rotation[1][0] * x + rotation[1][1] * y + rotation[1][2] * z),
+                               tPositionComponent(this->Z().Value() + rotation[2][0] * x + rotation[2][1] * y + rotation[2][2] * z));
+}
+
+//----------------------------------------------------------------------
+// tPoseWithCache TransformToLocalFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tPosition3D<TElement> tPoseWithCache<TElement, TAutoWrapPolicy>::TransformToLocalFrame(const tPosition3D<TElement> &position) const
+{
+  const TElement(&rotation)[3][3] = this->RotationMatrix();
+  const TElement offset[3] = { position.X().Value() - this->X().Value(), position.Y().Value() - this->Y().Value(), position.Z().Value() - this->Z().Value() };
+  TElement local_position[3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    local_position[i] = rotation[0][i] * offset[0] + rotation[1][i] * offset[1] + rotation[2][i] * offset[2];
+  }
+  return tPosition3D<TElement>(tPositionComponent(local_position[0]), tPositionComponent(local_position[1]), tPositionComponent(local_position[2]));
+}
+
+//----------------------------------------------------------------------
+// Numeric equality
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+bool IsEqual(const tPoseWithCache<TElement, TAutoWrapPolicy> &left, const tPoseWithCache<TElement, TAutoWrapPolicy> &right, float max_error, math::tFloatComparisonMethod method)
+{
+  return IsEqual(left.Pose(), right.Pose(), max_error, method);
+}
+
+//----------------------------------------------------------------------
+// Equality
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator == (const tPoseWithCache<TElement, TAutoWrapPolicy> &left, const tPoseWithCache<TElement, TAutoWrapPolicy> &right)
+{
+  return left.Pose() == right.Pose();
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator != (const tPoseWithCache<TElement, TAutoWrapPolicy> &left, const tPoseWithCache<TElement, TAutoWrapPolicy> &right)
+{
+  return !(left == right);
+}
+
+//----------------------------------------------------------------------
+// Streaming
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+std::ostream &operator << (std::ostream &stream, const tPoseWithCache<TElement, TAutoWrapPolicy> &pose)
+{
+  return stream << pose.Pose();
+}
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tPoseWithCache<TElement, TAutoWrapPolicy> &pose)
+{
+  return stream << pose.Pose();
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tPoseWithCache<TElement, TAutoWrapPolicy> &pose)
+{
+  typename tPoseWithCache<TElement, TAutoWrapPolicy>::tValue value;
+  stream >> value;
+  pose = value;
+  return stream;
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
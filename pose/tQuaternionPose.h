@@ -0,0 +1,238 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tQuaternionPose.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains tQuaternionPose
+ *
+ * \b tQuaternionPose
+ *
+ * A three dimensional pose whose orientation is stored as
+ * \ref tQuaternionOrientation. It is meant for code that concatenates
+ * many transformations, e.g. dead reckoning or kinematic chains, and
+ * converts implicitly from and to \ref tPose3D.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__pose__include_guard__
+#error Invalid include directive. Try #include "rrlib/localization/tPose.h" instead.
+#endif
+
+#ifndef __rrlib__localization__pose__tQuaternionPose_h__
+#define __rrlib__localization__pose__tQuaternionPose_h__
+
+#include "rrlib/localization/pose/tPose3D.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include <iostream>
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A three dimensional pose with quaternion orientation
+/*! Position is given in meters as in \ref tPose3D.
+ *  Concatenation does not renormalize the quaternion. For very long
+ *  chains call Orientation().Normalize() once in a while.
+ */
+template <typename TElement = double, typename TAutoWrapPolicy = math::angle::Signed>
+class tQuaternionPose
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TElement tElement;
+
+  //! The pose type with Euler angle orientation this class interconverts with.
+  typedef tPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy> tEulerPose;
+
+  //! The data type used to represent a single component of the position.
+  typedef si_units::tQuantity<si_units::tMeter, TElement> tPositionComponent;
+
+  //! The data type used to represent a single component of the orientation.
+  typedef typename tQuaternionOrientation<TElement, TAutoWrapPolicy>::template tComponent<> tOrientationComponent;
+
+  tQuaternionPose();
+
+  template <typename TX, typename TY, typename TZ>
+  tQuaternionPose(TX x, TY y, TZ z, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation = tQuaternionOrientation<TElement, TAutoWrapPolicy>::Identity());
+
+  tQuaternionPose(const tPosition3D<TElement> &position, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation);
+
+  template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+  tQuaternionPose(const tPose<3, TOtherElement, si_units::tMeter, si_units::tNoUnit, TOtherAutoWrapPolicy> &other);
+
+  //! Convert to a pose with roll, pitch and yaw
+  operator tEulerPose() const;
+
+  inline const tPosition3D<TElement> &Position() const
+  {
+    return this->position;
+  }
+  inline tPosition3D<TElement> &Position()
+  {
+    return this->position;
+  }
+
+  inline const tQuaternionOrientation<TElement, TAutoWrapPolicy> &Orientation() const
+  {
+    return this->orientation;
+  }
+  inline tQuaternionOrientation<TElement, TAutoWrapPolicy> &Orientation()
+  {
+    return this->orientation;
+  }
+
+  //! Get the x component of the position.
+  inline const tPositionComponent &X() const
+  {
+    return this->position.X();
+  }
+  //! Get/Set the x component of the position.
+  inline tPositionComponent &X()
+  {
+    return this->position.X();
+  }
+
+  //! Get the y component of the position.
+  inline const tPositionComponent &Y() const
+  {
+    return this->position.Y();
+  }
+  //! Get/Set the y component of the position.
+  inline tPositionComponent &Y()
+  {
+    return this->position.Y();
+  }
+
+  //! Get the z component of the position.
+  inline const tPositionComponent &Z() const
+  {
+    return this->position.Z();
+  }
+  //! Get/Set the z component of the position.
+  inline tPositionComponent &Z()
+  {
+    return this->position.Z();
+  }
+
+  //! Get the roll component of the orientation (computed from the quaternion).
+  inline tOrientationComponent Roll() const
+  {
+    return this->orientation.Roll();
+  }
+  //! Get the pitch component of the orientation (computed from the quaternion).
+  inline tOrientationComponent Pitch() const
+  {
+    return this->orientation.Pitch();
+  }
+  //! Get the yaw component of the orientation (computed from the quaternion).
+  inline tOrientationComponent Yaw() const
+  {
+    return this->orientation.Yaw();
+  }
+
+  void Reset();
+
+  //! Concatenate a relative transformation to this pose.
+  /*! The relative transformation is given in the local frame of this pose.
+   *  \param relative_transformation The transformation to apply.
+   */
+  void ApplyRelativePoseTransformation(const tQuaternionPose &relative_transformation);
+
+  tQuaternionPose GetPoseInParentFrame(const tQuaternionPose &reference) const;
+
+  tQuaternionPose GetPoseInLocalFrame(const tQuaternionPose &reference) const;
+
+  tQuaternionPose Inverted() const;
+
+  math::tMatrix<4, 4, TElement> GetTransformationMatrix() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tPosition3D<TElement> position;
+  tQuaternionOrientation<TElement, TAutoWrapPolicy> orientation;
+
+};
+
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool IsEqual(const tQuaternionPose<TElement, TAutoWrapPolicy> &left, const tQuaternionPose<TElement, TAutoWrapPolicy> &right, float max_error = 1E-6, math::tFloatComparisonMethod method = math::eFCM_ABSOLUTE_ERROR);
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator == (const tQuaternionPose<TElement, TAutoWrapPolicy> &left, const tQuaternionPose<TElement, TAutoWrapPolicy> &right);
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator != (const tQuaternionPose<TElement, TAutoWrapPolicy> &left, const tQuaternionPose<TElement, TAutoWrapPolicy> &right);
+
+template <typename TElement, typename TAutoWrapPolicy>
+std::ostream &operator << (std::ostream &stream, const tQuaternionPose<TElement, TAutoWrapPolicy> &pose);
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tQuaternionPose<TElement, TAutoWrapPolicy> &pose);
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tQuaternionPose<TElement, TAutoWrapPolicy> &pose);
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/pose/tQuaternionPose.hpp"
+
+#endif
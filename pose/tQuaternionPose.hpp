@@ -0,0 +1,226 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/pose/tQuaternionPose.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tQuaternionPose constructors
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionPose<TElement, TAutoWrapPolicy>::tQuaternionPose()
+{}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TX, typename TY, typename TZ>
+tQuaternionPose<TElement, TAutoWrapPolicy>::tQuaternionPose(TX x, TY y, TZ z, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation) :
+  position(tPositionComponent(x), tPositionComponent(y), tPositionComponent(z)),
+  orientation(orientation)
+{}
+
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionPose<TElement, TAutoWrapPolicy>::tQuaternionPose(const tPosition3D<TElement> &position, const tQuaternionOrientation<TElement, TAutoWrapPolicy> &orientation) :
+  position(position),
+  orientation(orientation)
+{}
+
+template <typename TElement, typename TAutoWrapPolicy>
+template <typename TOtherElement, typename TOtherAutoWrapPolicy>
+tQuaternionPose<TElement, TAutoWrapPolicy>::tQuaternionPose(const tPose<3, TOtherElement, si_units::tMeter, si_units::tNoUnit, TOtherAutoWrapPolicy> &other) :
+  position(tPositionComponent(other.X().Value()), tPositionComponent(other.Y().Value()), tPositionComponent(other.Z().Value())),
+  orientation(other.Orientation())
+{}
+
+//----------------------------------------------------------------------
+// tQuaternionPose conversion to tPose3D
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionPose<TElement, TAutoWrapPolicy>::operator tEulerPose() const
+{
+  return tEulerPose(this->position, typename tQuaternionOrientation<TElement, TAutoWrapPolicy>::tEulerOrientation(this->orientation));
+}
+
+//----------------------------------------------------------------------
+// tQuaternionPose Reset
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionPose<TElement, TAutoWrapPolicy>::Reset()
+{
+  *this = tQuaternionPose();
+}
+
+//----------------------------------------------------------------------
+// tQuaternionPose ApplyRelativePoseTransformation
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+void tQuaternionPose<TElement, TAutoWrapPolicy>::ApplyRelativePoseTransformation(const tQuaternionPose &relative_transformation)
+{
+  TElement translation[3] = { relative_transformation.X().Value(), relative_transformation.Y().Value(), relative_transformation.Z().Value() };
+  this->orientation.TransformVector(translation);
+  this->position.X() += tPositionComponent(translation[0]);
+  this->position.Y() += tPositionComponent(translation[1]);
+  this->position.Z() += tPositionComponent(translation[2]);
+  this->orientation *= relative_transformation.Orientation();
+}
+
+//----------------------------------------------------------------------
+// tQuaternionPose GetPoseInParentFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionPose<TElement, TAutoWrapPolicy> tQuaternionPose<TElement, TAutoWrapPolicy>::GetPoseInParentFrame(const tQuaternionPose &reference) const
+{
+  tQuaternionPose temp(reference);
+  temp.ApplyRelativePoseTransformation(*this);
+  return temp;
+}
+
+//----------------------------------------------------------------------
+// tQuaternionPose GetPoseInLocalFrame
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionPose<TElement, TAutoWrapPolicy> tQuaternionPose<TElement, TAutoWrapPolicy>::GetPoseInLocalFrame(const tQuaternionPose &reference) const
+{
+  const tQuaternionOrientation<TElement, TAutoWrapPolicy> inverse = reference.Orientation().Inverted();
+  TElement translation[3] = { (this->X() - reference.X()).Value(), (this->Y() - reference.Y()).Value(), (this->Z() - reference.Z()).Value() };
+  inverse.TransformVector(translation);
+  return tQuaternionPose(translation[0], translation[1], translation[2], inverse * this->orientation);
+}
+
+//----------------------------------------------------------------------
+// tQuaternionPose Inverted
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+tQuaternionPose<TElement, TAutoWrapPolicy> tQuaternionPose<TElement, TAutoWrapPolicy>::Inverted() const
+{
+  const tQuaternionOrientation<TElement, TAutoWrapPolicy> inverse = this->orientation.Inverted();
+  TElement translation[3] = { -this->X().Value(), -this->Y().Value(), -this->Z().Value() };
+  inverse.TransformVector(translation);
+  return tQuaternionPose(translation[0], translation[1], translation[2], inverse);
+}
+
+//----------------------------------------------------------------------
+// tQuaternionPose GetTransformationMatrix
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+math::tMatrix<4, 4, TElement> tQuaternionPose<TElement, TAutoWrapPolicy>::GetTransformationMatrix() const
+{
+  TElement rotation[3][3];
+  this->orientation.GetMatrix(rotation);
+  return math::tMatrix<4, 4, TElement>(rotation[0][0], rotation[0][1], rotation[0][2], this->X().Value(),
+                                       rotation[1][0], rotation[1][1], rotation[1][2], this->Y().Value(),
+                                       rotation[2][0], rotation[2][1], rotation[2][2], this->Z().Value(),
+                                       0, 0, 0, 1);
+}
+
+//----------------------------------------------------------------------
+// Numeric equality
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+bool IsEqual(const tQuaternionPose<TElement, TAutoWrapPolicy> &left, const tQuaternionPose<TElement, TAutoWrapPolicy> &right, float max_error, math::tFloatComparisonMethod method)
+{
+  return IsEqual(left.X(), right.X(), max_error, method) && IsEqual(left.Y(), right.Y(), max_error, method) && IsEqual(left.Z(), right.Z(), max_error, method) &&
+         IsEqual(left.Orientation(), right.Orientation(), max_error, method);
+}
+
+//----------------------------------------------------------------------
+// Equality
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator == (const tQuaternionPose<TElement, TAutoWrapPolicy> &left, const tQuaternionPose<TElement, TAutoWrapPolicy> &right)
+{
+  return left.Position() == right.Position() && left.Orientation() == right.Orientation();
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+bool operator != (const tQuaternionPose<TElement, TAutoWrapPolicy> &left, const tQuaternionPose<TElement, TAutoWrapPolicy> &right)
+{
+  return !(left == right);
+}
+
+//----------------------------------------------------------------------
+// Streaming
+//----------------------------------------------------------------------
+template <typename TElement, typename TAutoWrapPolicy>
+std::ostream &operator << (std::ostream &stream, const tQuaternionPose<TElement, TAutoWrapPolicy> &pose)
+{
+  return stream << static_cast<typename tQuaternionPose<TElement, TAutoWrapPolicy>::tEulerPose>(pose);
+}
+
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tOutputStream &operator << (serialization::tOutputStream &stream, const tQuaternionPose<TElement, TAutoWrapPolicy> &pose)
+{
+  return stream << pose.X() << pose.Y() << pose.Z() << pose.Orientation();
+}
+
+template <typename TElement, typename TAutoWrapPolicy>
+serialization::tInputStream &operator >> (serialization::tInputStream &stream, tQuaternionPose<TElement, TAutoWrapPolicy> &pose)
+{
+  return stream >> pose.X() >> pose.Y() >> pose.Z() >> pose.Orientation();
+}
+
+#endif
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
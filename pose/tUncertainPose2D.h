@@ -178,6 +178,22 @@ public:
     return this->CovarianceYawYaw();
   }
 
+  //! Compound this pose with an independent uncertain relative transformation
+  /*! This is the operator (+) of Smith, Self and Cheeseman: the mean is
+   *  updated like in ApplyRelativePoseTransformation and the covariance is
+   *  propagated to first order in the same pass, without any allocation.
+   *  \param relative_transformation The transformation given in the local frame of this pose
+   */
+  template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
+  void Compound(const tUncertainPose<2, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation);
+
+  //! Replace this pose by its inverse rigid transformation and transform the covariance accordingly
+  /*! This is the operator (-) of Smith, Self and Cheeseman.
+   */
+  void Invert();
+
+  tUncertainPose Inverted() const;
+
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
@@ -32,6 +32,7 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <cmath>
 #ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
 #include <sstream>
 #endif
@@ -78,6 +79,106 @@ tUncertainPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy
   tPoseBase(tPose2D<>(x, y, yaw), covariance)
 {}
 
+//----------------------------------------------------------------------
+// tUncertainPose2D Compound
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
+void tUncertainPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Compound(const tUncertainPose<2, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation)
+{
+  const TElement yaw = this->Yaw().Value().Value();
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+  const TElement relative_x = relative_transformation.X().Value();
+  const TElement relative_y = relative_transformation.Y().Value();
+  const TElement dx = cos_yaw * relative_x - sin_yaw * relative_y;
+  const TElement dy = sin_yaw * relative_x + cos_yaw * relative_y;
+  this->Set(this->X().Value() + dx, this->Y().Value() + dy, tOrientationComponent<>(yaw + relative_transformation.Yaw().Value().Value()));
+
+  // J_pose = [[1, 0, -dy], [0, 1, dx], [0, 0, 1]]
+  tCovarianceMatrix<> &covariance = this->Covariance();
+  const TElement xx = covariance[0][0];
+  const TElement xy = covariance[0][1];
+  const TElement x_yaw = covariance[0][2];
+  const TElement yy = covariance[1][1];
+  const TElement y_yaw = covariance[1][2];
+  const TElement yaw_yaw = covariance[2][2];
+  covariance[0][0] = xx - 2 * dy * x_yaw + dy * dy * yaw_yaw;
+  covariance[0][1] = xy - dy * y_yaw + dx * x_yaw - dx * dy * yaw_yaw;
+  covariance[0][2] = x_yaw - dy * yaw_yaw;
+  covariance[1][1] = yy + 2 * dx * y_yaw + dx * dx * yaw_yaw;
+  covariance[1][2] = y_yaw + dx * yaw_yaw;
+
+  // J_relative = [[cos, -sin, 0], [sin, cos, 0], [0, 0, 1]]
+  const auto &relative_covariance = relative_transformation.Covariance();
+  const TElement q_xx = relative_covariance[0][0];
+  const TElement q_xy = relative_covariance[0][1];
+  const TElement q_x_yaw = relative_covariance[0][2];
+  const TElement q_yy = relative_covariance[1][1];
+  const TElement q_y_yaw = relative_covariance[1][2];
+  const TElement sin_cos = sin_yaw * cos_yaw;
+  covariance[0][0] += cos_yaw * cos_yaw * q_xx - 2 * sin_cos * q_xy + sin_yaw * sin_yaw * q_yy;
+  covariance[0][1] += sin_cos * (q_xx - q_yy) + (cos_yaw * cos_yaw - sin_yaw * sin_yaw) * q_xy;
+  covariance[0][2] += cos_yaw * q_x_yaw - sin_yaw * q_y_yaw;
+  covariance[1][1] += sin_yaw * sin_yaw * q_xx + 2 * sin_cos * q_xy + cos_yaw * cos_yaw * q_yy;
+  covariance[1][2] += sin_yaw * q_x_yaw + cos_yaw * q_y_yaw;
+  covariance[2][2] = yaw_yaw + relative_covariance[2][2];
+
+  covariance[1][0] = covariance[0][1];
+  covariance[2][0] = covariance[0][2];
+  covariance[2][1] = covariance[1][2];
+}
+
+//----------------------------------------------------------------------
+// tUncertainPose2D Invert
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tUncertainPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Invert()
+{
+  const TElement yaw = this->Yaw().Value().Value();
+  const TElement sin_yaw = std::sin(yaw);
+  const TElement cos_yaw = std::cos(yaw);
+  const TElement x = this->X().Value();
+  const TElement y = this->Y().Value();
+  const TElement inverted_x = -cos_yaw * x - sin_yaw * y;
+  const TElement inverted_y = sin_yaw * x - cos_yaw * y;
+  this->Set(inverted_x, inverted_y, tOrientationComponent<>(-yaw));
+
+  const TElement jacobian[3][3] =
+  {
+    { -cos_yaw, -sin_yaw, inverted_y },
+    { sin_yaw, -cos_yaw, -inverted_x },
+    { 0, 0, -1 }
+  };
+  tCovarianceMatrix<> &covariance = this->Covariance();
+  TElement temp[3][3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      temp[i][j] = jacobian[i][0] * covariance[0][j] + jacobian[i][1] * covariance[1][j] + jacobian[i][2] * covariance[2][j];
+    }
+  }
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      covariance[i][j] = temp[i][0] * jacobian[j][0] + temp[i][1] * jacobian[j][1] + temp[i][2] * jacobian[j][2];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tUncertainPose2D Inverted
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tUncertainPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tUncertainPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Inverted() const
+{
+  tUncertainPose temp(*this);
+  temp.Invert();
+  return temp;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -90,6 +90,134 @@ tUncertainPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy
   tPoseBase(tPose3D<>(x, y, z, roll, pitch, yaw), covariance)
 {}
 
+//----------------------------------------------------------------------
+// tUncertainPose3D Compound
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+template <typename TTransformationElement, typename TTransformationAutoWrapPolicy>
+void tUncertainPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Compound(const tUncertainPose<3, TTransformationElement, TPositionSIUnit, TOrientationSIUnit, TTransformationAutoWrapPolicy> &relative_transformation)
+{
+  const TElement previous_pitch = this->Pitch().Value().Value();
+  const TElement previous_yaw = this->Yaw().Value().Value();
+  TElement rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(rotation, this->Roll().Value().Value(), previous_pitch, previous_yaw);
+  TElement relative_rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(relative_rotation, relative_transformation.Roll().Value().Value(), relative_transformation.Pitch().Value().Value(), relative_transformation.Yaw().Value().Value());
+
+  const TElement relative_x = relative_transformation.X().Value();
+  const TElement relative_y = relative_transformation.Y().Value();
+  const TElement relative_z = relative_transformation.Z().Value();
+  const TElement translation[3] =
+  {
+    rotation[0][0] * relative_x + rotation[0][1] * relative_y + rotation[0][2] * relative_z,
+    rotation[1][0] * relative_x + rotation[1][1] * relative_y + rotation[1][2] * relative_z,
+    rotation[2][0] * relative_x + rotation[2][1] * relative_y + rotation[2][2] * relative_z
+  };
+  this->SetPosition(this->X().Value() + translation[0], this->Y().Value() + translation[1], this->Z().Value() + translation[2]);
+
+  TElement result[3][3];
+  orientation::Multiply(result, rotation, relative_rotation);
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(result, roll, pitch, yaw);
+  this->SetOrientation(tOrientationComponent<>(roll), tOrientationComponent<>(pitch), tOrientationComponent<>(yaw));
+
+  // J_pose = [[I, -[t]x * E], [0, E'^-1 * E]] with E mapping Euler rates to angular velocities in the parent frame
+  TElement parent_rate[3][3];
+  orientation::GetParentFrameAngularRateMatrix(parent_rate, previous_pitch, previous_yaw);
+  const TElement negative_skew_translation[3][3] =
+  {
+    { 0, translation[2], -translation[1] },
+    { -translation[2], 0, translation[0] },
+    { translation[1], -translation[0], 0 }
+  };
+  TElement m[3][3];
+  orientation::Multiply(m, negative_skew_translation, parent_rate);
+  TElement inverse_parent_rate[3][3];
+  orientation::GetInverseParentFrameAngularRateMatrix(inverse_parent_rate, pitch, yaw);
+  TElement n[3][3];
+  orientation::Multiply(n, inverse_parent_rate, parent_rate);
+  pose::PropagateCovariance(this->Covariance(), m, n);
+
+  // J_relative = [[R, 0], [0, L'^-1 * L]] with L mapping Euler rates to angular velocities in the local frame
+  TElement local_rate[3][3];
+  orientation::GetLocalFrameAngularRateMatrix<TElement>(local_rate, relative_transformation.Roll().Value().Value(), relative_transformation.Pitch().Value().Value());
+  TElement inverse_local_rate[3][3];
+  orientation::GetInverseLocalFrameAngularRateMatrix(inverse_local_rate, roll, pitch);
+  TElement k[3][3];
+  orientation::Multiply(k, inverse_local_rate, local_rate);
+  pose::AddPropagatedCovariance(this->Covariance(), relative_transformation.Covariance(), rotation, k);
+}
+
+//----------------------------------------------------------------------
+// tUncertainPose3D Invert
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tUncertainPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Invert()
+{
+  const TElement previous_pitch = this->Pitch().Value().Value();
+  const TElement previous_yaw = this->Yaw().Value().Value();
+  TElement rotation[3][3];
+  orientation::GetRotationMatrix<TElement>(rotation, this->Roll().Value().Value(), previous_pitch, previous_yaw);
+
+  const TElement x = this->X().Value();
+  const TElement y = this->Y().Value();
+  const TElement z = this->Z().Value();
+  this->SetPosition(-(rotation[0][0] * x + rotation[1][0] * y + rotation[2][0] * z),
+                    -(rotation[0][1] * x + rotation[1][1] * y + rotation[2][1] * z),
+                    -(rotation[0][2] * x + rotation[1][2] * y + rotation[2][2] * z));
+
+  TElement transposed[3][3];
+  TElement negative_transposed[3][3];
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      transposed[i][j] = rotation[j][i];
+      negative_transposed[i][j] = -rotation[j][i];
+    }
+  }
+  TElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(transposed, roll, pitch, yaw);
+  this->SetOrientation(tOrientationComponent<>(roll), tOrientationComponent<>(pitch), tOrientationComponent<>(yaw));
+
+  // J = [[-R^T, R^T * -[t]x * E], [0, -L'^-1 * E]]
+  TElement parent_rate[3][3];
+  orientation::GetParentFrameAngularRateMatrix(parent_rate, previous_pitch, previous_yaw);
+  const TElement negative_skew_position[3][3] =
+  {
+    { 0, z, -y },
+    { -z, 0, x },
+    { y, -x, 0 }
+  };
+  TElement temp[3][3];
+  orientation::Multiply(temp, negative_skew_position, parent_rate);
+  TElement m[3][3];
+  orientation::MultiplyTransposed(m, rotation, temp);
+  TElement inverse_local_rate[3][3];
+  orientation::GetInverseLocalFrameAngularRateMatrix(inverse_local_rate, roll, pitch);
+  TElement n[3][3];
+  orientation::Multiply(n, inverse_local_rate, parent_rate);
+  for (size_t i = 0; i < 3; ++i)
+  {
+    for (size_t j = 0; j < 3; ++j)
+    {
+      n[i][j] = -n[i][j];
+    }
+  }
+  pose::PropagateCovariance(this->Covariance(), negative_transposed, m, n);
+}
+
+//----------------------------------------------------------------------
+// tUncertainPose3D Inverted
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tUncertainPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tUncertainPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::Inverted() const
+{
+  tUncertainPose temp(*this);
+  temp.Invert();
+  return temp;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -158,6 +158,17 @@ serialization::tStringInputStream &operator >> (serialization::tStringInputStrea
 
 #endif
 
+//! The number of raw values of the covariance of an uncertain pose and 0 for other poses, for use in constant expressions
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+constexpr size_t GetNumberOfCovarianceValues(const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> *)
+{
+  return Tdimension == 2 ? 9 : 36;
+}
+constexpr size_t GetNumberOfCovarianceValues(const void *)
+{
+  return 0;
+}
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
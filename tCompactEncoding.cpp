@@ -0,0 +1,160 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tCompactEncoding.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/localization/tCompactEncoding.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const size_t tCompactEncoding::cBYTES_PER_COMPONENT;
+const size_t tCompactEncoding::cBYTES_PER_COVARIANCE_VALUE;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+//! The quantised value that stands for NaN, which is therefore not used for finite values
+const int32_t cNAN_COMPONENT = std::numeric_limits<int32_t>::min();
+
+inline void WriteUnsigned(uint32_t value, uint8_t *&buffer)
+{
+  buffer[0] = static_cast<uint8_t>(value);
+  buffer[1] = static_cast<uint8_t>(value >> 8);
+  buffer[2] = static_cast<uint8_t>(value >> 16);
+  buffer[3] = static_cast<uint8_t>(value >> 24);
+  buffer += 4;
+}
+
+inline uint32_t ReadUnsigned(const uint8_t *&buffer)
+{
+  const uint32_t value = static_cast<uint32_t>(buffer[0]) | (static_cast<uint32_t>(buffer[1]) << 8) | (static_cast<uint32_t>(buffer[2]) << 16) | (static_cast<uint32_t>(buffer[3]) << 24);
+  buffer += 4;
+  return value;
+}
+
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding constructors
+//----------------------------------------------------------------------
+tCompactEncoding::tCompactEncoding(double position_resolution, double orientation_resolution, tCovarianceMode covariance_mode) :
+  position_resolution(position_resolution),
+  orientation_resolution(orientation_resolution),
+  covariance_mode(covariance_mode)
+{
+  assert(position_resolution > 0 && orientation_resolution > 0);
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding WriteComponent
+//----------------------------------------------------------------------
+void tCompactEncoding::WriteComponent(double value, double resolution, uint8_t *&buffer)
+{
+  if (std::isnan(value))
+  {
+    WriteUnsigned(static_cast<uint32_t>(cNAN_COMPONENT), buffer);
+    return;
+  }
+  const double quantized = std::round(value / resolution);
+  const double clamped = std::max<double>(cNAN_COMPONENT + 1, std::min<double>(std::numeric_limits<int32_t>::max(), quantized));
+  WriteUnsigned(static_cast<uint32_t>(static_cast<int32_t>(clamped)), buffer);
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding ReadComponent
+//----------------------------------------------------------------------
+double tCompactEncoding::ReadComponent(double resolution, const uint8_t *&buffer)
+{
+  const int32_t quantized = static_cast<int32_t>(ReadUnsigned(buffer));
+  return quantized == cNAN_COMPONENT ? std::numeric_limits<double>::quiet_NaN() : quantized * resolution;
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding WriteFloat
+//----------------------------------------------------------------------
+void tCompactEncoding::WriteFloat(float value, uint8_t *&buffer)
+{
+  static_assert(sizeof(float) == sizeof(uint32_t), "IEEE 754 single precision floats are required");
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  WriteUnsigned(bits, buffer);
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding ReadFloat
+//----------------------------------------------------------------------
+float tCompactEncoding::ReadFloat(const uint8_t *&buffer)
+{
+  const uint32_t bits = ReadUnsigned(buffer);
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,192 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tCompactEncoding.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains \ref rrlib::localization::tCompactEncoding
+ *
+ * \b tCompactEncoding
+ *
+ * A compact binary encoding of poses and twists for bandwidth-bound links.
+ * Every component is quantised to a configurable resolution and written as
+ * 32 bit integer, i.e. 12 bytes for 2D and 24 bytes for 3D instead of 24
+ * and 48 bytes of doubles. The covariance of uncertain poses is optionally
+ * added as packed upper triangle of 32 bit floats (6 or 21 values).
+ * The smallest integer is reserved for NaN, so invalid values reach the
+ * receiver as such instead of as a saturated number.
+ *
+ * The byte order is little endian on all platforms. The data is not
+ * self-describing: sender and receiver have to use the same encoding
+ * and pose types. Decoding reads directly from the received buffer into
+ * existing objects without any intermediate copies or allocations.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__tCompactEncoding_h__
+#define __rrlib__localization__tCompactEncoding_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tPose.h"
+#include "rrlib/localization/tUncertainPose.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Quantised binary encoding of poses, twists and their uncertain variants
+class tCompactEncoding
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  //! How covariances of uncertain poses are transmitted
+  enum class tCovarianceMode
+  {
+    NONE,         //!< Only the mean is transmitted, the covariance of the receiving object is set to zero
+    PACKED_FLOAT  //!< The upper triangle is transmitted as 32 bit floats
+  };
+
+  static const size_t cBYTES_PER_COMPONENT = 4;
+  static const size_t cBYTES_PER_COVARIANCE_VALUE = 4;
+
+  //! Create an encoding with the given resolutions
+  /*! \param position_resolution    Resolution of the position components in their SI unit, e.g. 1 mm for poses and 1 mm/s for twists
+   *  \param orientation_resolution Resolution of the orientation components in radian (per second for twists), 0.01° by default
+   *  \param covariance_mode        Whether covariances are transmitted
+   */
+  explicit tCompactEncoding(double position_resolution = 1E-3, double orientation_resolution = 0.01 * math::cPI / 180, tCovarianceMode covariance_mode = tCovarianceMode::PACKED_FLOAT);
+
+  inline double PositionResolution() const
+  {
+    return this->position_resolution;
+  }
+
+  inline double OrientationResolution() const
+  {
+    return this->orientation_resolution;
+  }
+
+  inline tCovarianceMode CovarianceMode() const
+  {
+    return this->covariance_mode;
+  }
+
+  //! The number of bytes Encode writes for the given pose
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t GetEncodedSize(const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t GetEncodedSize(const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t GetEncodedSize(const tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+
+  //! Write a pose to buffer, which must provide GetEncodedSize(pose) bytes
+  /*! Values outside the range of the quantisation are saturated, NaN is kept.
+   *  \returns The number of bytes written
+   */
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t Encode(const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *buffer) const;
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t Encode(const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *buffer) const;
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t Encode(const tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *buffer) const;
+
+  //! Read a pose written by Encode into an existing object
+  /*! Without transmitted covariances the covariance of an uncertain pose is
+   *  set to zero, so a reused object never mixes a new mean with an old covariance.
+   *  \returns The number of bytes read
+   */
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t Decode(const uint8_t *buffer, tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t Decode(const uint8_t *buffer, tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  size_t Decode(const uint8_t *buffer, tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+
+  //! Read count consecutive poses into preallocated objects
+  /*! \returns The number of bytes read
+   */
+  template <typename TPose>
+  size_t Decode(const uint8_t *buffer, size_t count, TPose *poses) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  double position_resolution;
+  double orientation_resolution;
+  tCovarianceMode covariance_mode;
+
+  static void WriteComponent(double value, double resolution, uint8_t *&buffer);
+  static double ReadComponent(double resolution, const uint8_t *&buffer);
+
+  static void WriteFloat(float value, uint8_t *&buffer);
+  static float ReadFloat(const uint8_t *&buffer);
+
+  template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  void EncodeMean(const tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *&buffer) const;
+  template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  void EncodeMean(const tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *&buffer) const;
+
+  template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  void DecodeMean(const uint8_t *&buffer, tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+  template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  void DecodeMean(const uint8_t *&buffer, tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const;
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/tCompactEncoding.hpp"
+
+#endif
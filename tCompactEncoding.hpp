@@ -0,0 +1,258 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tCompactEncoding.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tCompactEncoding GetEncodedSize
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::GetEncodedSize(const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &) const
+{
+  return (Tdimension == 2 ? 3 : 6) * cBYTES_PER_COMPONENT;
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::GetEncodedSize(const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &) const
+{
+  const size_t covariance_values = Tdimension == 2 ? 6 : 21;
+  return (Tdimension == 2 ? 3 : 6) * cBYTES_PER_COMPONENT + (this->covariance_mode == tCovarianceMode::PACKED_FLOAT ? covariance_values * cBYTES_PER_COVARIANCE_VALUE : 0);
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::GetEncodedSize(const tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &) const
+{
+  const size_t covariance_values = tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::tCovariance::cNUMBER_OF_VALUES;
+  return (Tdimension == 2 ? 3 : 6) * cBYTES_PER_COMPONENT + (this->covariance_mode == tCovarianceMode::PACKED_FLOAT ? covariance_values * cBYTES_PER_COVARIANCE_VALUE : 0);
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding Encode
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::Encode(const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *buffer) const
+{
+  uint8_t *start = buffer;
+  this->EncodeMean(pose, buffer);
+  return buffer - start;
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::Encode(const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *buffer) const
+{
+  uint8_t *start = buffer;
+  this->EncodeMean(pose, buffer);
+  if (this->covariance_mode == tCovarianceMode::PACKED_FLOAT)
+  {
+    const size_t size = Tdimension == 2 ? 3 : 6;
+    for (size_t i = 0; i < size; ++i)
+    {
+      for (size_t j = i; j < size; ++j)
+      {
+        WriteFloat(static_cast<float>(pose.Covariance()[i][j]), buffer);
+      }
+    }
+  }
+  return buffer - start;
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::Encode(const tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *buffer) const
+{
+  uint8_t *start = buffer;
+  this->EncodeMean(pose, buffer);
+  if (this->covariance_mode == tCovarianceMode::PACKED_FLOAT)
+  {
+    const TElement *values = pose.Covariance().Values();
+    for (size_t i = 0; i < tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::tCovariance::cNUMBER_OF_VALUES; ++i)
+    {
+      WriteFloat(static_cast<float>(values[i]), buffer);
+    }
+  }
+  return buffer - start;
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding Decode
+//----------------------------------------------------------------------
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::Decode(const uint8_t *buffer, tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const
+{
+  const uint8_t *start = buffer;
+  this->DecodeMean(buffer, pose);
+  return buffer - start;
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::Decode(const uint8_t *buffer, tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const
+{
+  const uint8_t *start = buffer;
+  this->DecodeMean(buffer, pose);
+  if (this->covariance_mode == tCovarianceMode::PACKED_FLOAT)
+  {
+    const size_t size = Tdimension == 2 ? 3 : 6;
+    for (size_t i = 0; i < size; ++i)
+    {
+      for (size_t j = i; j < size; ++j)
+      {
+        pose.Covariance()[i][j] = ReadFloat(buffer);
+        pose.Covariance()[j][i] = pose.Covariance()[i][j];
+      }
+    }
+  }
+  else
+  {
+    const size_t size = Tdimension == 2 ? 3 : 6;
+    for (size_t i = 0; i < size; ++i)
+    {
+      for (size_t j = 0; j < size; ++j)
+      {
+        pose.Covariance()[i][j] = 0;
+      }
+    }
+  }
+  return buffer - start;
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+size_t tCompactEncoding::Decode(const uint8_t *buffer, tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const
+{
+  const uint8_t *start = buffer;
+  this->DecodeMean(buffer, pose);
+  if (this->covariance_mode == tCovarianceMode::PACKED_FLOAT)
+  {
+    TElement *values = pose.Covariance().Values();
+    for (size_t i = 0; i < tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::tCovariance::cNUMBER_OF_VALUES; ++i)
+    {
+      values[i] = ReadFloat(buffer);
+    }
+  }
+  else
+  {
+    TElement *values = pose.Covariance().Values();
+    std::fill(values, values + tPackedUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy>::tCovariance::cNUMBER_OF_VALUES, TElement(0));
+  }
+  return buffer - start;
+}
+
+template <typename TPose>
+size_t tCompactEncoding::Decode(const uint8_t *buffer, size_t count, TPose *poses) const
+{
+  const uint8_t *start = buffer;
+  for (size_t i = 0; i < count; ++i)
+  {
+    buffer += this->Decode(buffer, poses[i]);
+  }
+  return buffer - start;
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding EncodeMean
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tCompactEncoding::EncodeMean(const tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *&buffer) const
+{
+  WriteComponent(pose.X().Value(), this->position_resolution, buffer);
+  WriteComponent(pose.Y().Value(), this->position_resolution, buffer);
+  WriteComponent(pose.Yaw().Value().Value(), this->orientation_resolution, buffer);
+}
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tCompactEncoding::EncodeMean(const tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, uint8_t *&buffer) const
+{
+  WriteComponent(pose.X().Value(), this->position_resolution, buffer);
+  WriteComponent(pose.Y().Value(), this->position_resolution, buffer);
+  WriteComponent(pose.Z().Value(), this->position_resolution, buffer);
+  WriteComponent(pose.Roll().Value().Value(), this->orientation_resolution, buffer);
+  WriteComponent(pose.Pitch().Value().Value(), this->orientation_resolution, buffer);
+  WriteComponent(pose.Yaw().Value().Value(), this->orientation_resolution, buffer);
+}
+
+//----------------------------------------------------------------------
+// tCompactEncoding DecodeMean
+//----------------------------------------------------------------------
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tCompactEncoding::DecodeMean(const uint8_t *&buffer, tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const
+{
+  typedef tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose;
+  const TElement x = ReadComponent(this->position_resolution, buffer);
+  const TElement y = ReadComponent(this->position_resolution, buffer);
+  const TElement yaw = ReadComponent(this->orientation_resolution, buffer);
+  pose.Set(x, y, typename tPose::template tOrientationComponent<>(yaw));
+}
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tCompactEncoding::DecodeMean(const uint8_t *&buffer, tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose) const
+{
+  typedef tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> tPose;
+  const TElement x = ReadComponent(this->position_resolution, buffer);
+  const TElement y = ReadComponent(this->position_resolution, buffer);
+  const TElement z = ReadComponent(this->position_resolution, buffer);
+  const TElement roll = ReadComponent(this->orientation_resolution, buffer);
+  const TElement pitch = ReadComponent(this->orientation_resolution, buffer);
+  const TElement yaw = ReadComponent(this->orientation_resolution, buffer);
+  pose.Set(x, y, z, typename tPose::template tOrientationComponent<>(roll), typename tPose::template tOrientationComponent<>(pitch), typename tPose::template tOrientationComponent<>(yaw));
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
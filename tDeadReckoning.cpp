@@ -40,7 +40,6 @@
 //----------------------------------------------------------------------
 // Debugging
 //----------------------------------------------------------------------
-#include <cassert>
 
 //----------------------------------------------------------------------
 // Namespace usage
@@ -65,50 +64,10 @@ namespace localization
 //----------------------------------------------------------------------
 // Implementation
 //----------------------------------------------------------------------
-tDeadReckoning::tDeadReckoning(const tPose &initial_pose) : pose(initial_pose), previous_twist_available(false)
-{
-}
-
-void tDeadReckoning::SetPose(const tPose &pose)
-{
-  this->pose = pose;
-}
-
-const tDeadReckoning::tPose & tDeadReckoning::GetPose() const
-{
-  return this->pose;
-}
-
-void tDeadReckoning::ResetTwist()
-{
-  this->previous_twist = tTwist();
-  this->previous_twist_available = false;
-}
-
-void tDeadReckoning::UpdatePose(const tTwist &twist, const rrlib::time::tDuration &elapsed_time)
-{
-  if (previous_twist_available)
-    UpdatePose(this->pose, this->previous_twist, twist, elapsed_time);
-  else
-    UpdatePose(this->pose, twist, elapsed_time);
-
-  previous_twist = twist;
-  previous_twist_available = true;
-}
-
-
-void tDeadReckoning::UpdatePose(tPose &pose, const tTwist &twist, const rrlib::time::tDuration &elapsed_time)
-{
-  rrlib::si_units::tTime<double> elapsed(std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count());
-  pose.ApplyRelativePoseTransformation(twist * elapsed);
-}
-
-void tDeadReckoning::UpdatePose(tPose &pose, const tTwist &previous_twist, const tTwist &twist, const rrlib::time::tDuration &elapsed_time)
-{
-  // do the trapezoidal calculation
-  UpdatePose(pose, (previous_twist + twist) * 0.5, elapsed_time);
-}
 
+template class tGenericDeadReckoning<double>;
+template class tGenericDeadReckoning<float>;
+template class tGenericDeadReckoning<float, double>;
 
 //----------------------------------------------------------------------
 // End of namespace declaration
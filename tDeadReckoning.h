@@ -25,7 +25,7 @@
  *
  * \date    2014-06-05
  *
- * \brief   Contains \ref rrlib::localization::tDeadReckoning
+ * \brief   Contains \ref rrlib::localization::tGenericDeadReckoning and \ref rrlib::localization::tDeadReckoning
  *
  */
 //----------------------------------------------------------------------
@@ -35,11 +35,17 @@
 //----------------------------------------------------------------------
 // External includes (system with <>, local with "")
 //----------------------------------------------------------------------
+#include <type_traits>
+#include <vector>
+
+#include "rrlib/time/time.h"
 
 //----------------------------------------------------------------------
 // Internal includes with ""
 //----------------------------------------------------------------------
+#include "rrlib/localization/tPose.h"
 #include "rrlib/localization/tUncertainPose.h"
+#include "rrlib/localization/tSharedPose.h"
 
 //----------------------------------------------------------------------
 // Namespace declaration
@@ -59,8 +65,30 @@ namespace localization
 //! Class containing functions to perform dead reckoning.
 /** The calculations are based on trapezoidal approximation of the integration.
   * The class can either be instantiated or the static methods can be used, depending on what is more useful.
+  *
+  * The element type of poses and twists defaults to double. With float the
+  * memory footprint and the cost of the covariance propagation are halved,
+  * which is useful for large particle sets or small embedded platforms.
+  * Rounding errors of float accumulate over long integrations, though: after
+  * an hour at 100 Hz the position may be off by centimeters. For that case
+  * TAccumulatorElement = double selects an accumulate-in-double mode. Twists
+  * and poses are still exchanged as float, but the integrated pose is kept
+  * in double and only rounded when it is handed out.
+  *
+  * Twists that arrive over a network may be delayed or out of order. For that case
+  * UpdatePose can be called with the timestamp of the twist instead of the elapsed time.
+  * The twists of the last updates are kept together with the pose at their time as
+  * checkpoints, so that a late twist is inserted at its place and only the updates
+  * after it are integrated again.
+  *
+  * tDeadReckoning is the instantiation for double, so existing code that uses
+  * tDeadReckoning without template arguments keeps compiling.
+  *
+  * @tparam TElement The element type of the poses and twists
+  * @tparam TAccumulatorElement The element type of the integrated pose
   */
-class tDeadReckoning
+template <typename TElement = double, typename TAccumulatorElement = TElement>
+class tGenericDeadReckoning
 {
 
 //----------------------------------------------------------------------
@@ -69,14 +97,38 @@ class tDeadReckoning
 public:
 
   //! The pose type used in this class
-  typedef tUncertainPose3D<> tPose;
+  typedef tUncertainPose3D<TElement> tPose;
   //! The twist (linear and angular velocities) type used in this class
-  typedef tUncertainTwist3D<> tTwist;
+  typedef tUncertainTwist3D<TElement> tTwist;
+  //! The pose type the integration is accumulated in
+  typedef tUncertainPose3D<TAccumulatorElement> tAccumulatedPose;
+  //! The pose type without covariance for UpdateMean
+  typedef tPose3D<TAccumulatorElement> tMeanPose;
+  //! The twist type without covariance for UpdateMean
+  typedef tTwist3D<TElement> tMeanTwist;
+  //! Structure of arrays for particle sets
+  typedef tPoseArray3D<TElement> tPoseArray;
+  //! Structure of arrays for the twists of particle sets
+  typedef localization::tPoseArray<3, TElement, math::angle::NoWrap> tTwistArray;
+
+  //! How the motion during one call of UpdatePose is integrated
+  /** The methods interpret the orientation part of the twist differently: eDRIM_TRAPEZOID scales it by the
+    * elapsed time and uses the result as roll, pitch and yaw increments, whereas the stepping methods take it
+    * as the angular velocity in the local frame, e.g. as measured by a gyroscope. Both agree if the twist
+    * rotates about a single axis, e.g. for planar motion; otherwise switching the method changes the meaning
+    * of the input.
+    */
+  enum tIntegrationMethod
+  {
+    eDRIM_TRAPEZOID,   //!< One step with the mean of the previous and the current twist
+    eDRIM_SUB_STEPS,   //!< Steps of at most the maximum step along the exponential map with the twist in the middle of the step
+    eDRIM_RUNGE_KUTTA  //!< Fourth order Runge-Kutta-Munthe-Kaas steps of at most the maximum step along the exponential map
+  };
 
   //! Create a new dead reckoning instance with the specified initial pose
   /** @param initial_pose The initial pose to initialize the object with
    */
-  tDeadReckoning(const tPose &initial_pose = tPose());
+  tGenericDeadReckoning(const tPose &initial_pose = tPose());
 
   //! Set the internal pose to a different one
   /** @param pose The pose to set internal state to
@@ -84,12 +136,49 @@ public:
   void SetPose(const tPose &pose);
 
   //! Get the internal pose
-  /** @return The pose
+  /** In accumulate-in-double mode this is the pose in the precision of the accumulator.
+    * @return The pose
+    */
+  const tAccumulatedPose & GetPose() const;
+
+  //! Enable or disable publishing the pose for readers in other threads
+  /** Publishing converts and stores the pose after every SetPose and UpdatePose,
+    * which single-threaded users do not need. It is therefore disabled by default.
+    * Enabling it publishes the current pose right away.
+    * @param publish Whether the pose is to be published
+    */
+  void SetPublishPose(bool publish);
+
+  //! Get a copy of the internal pose from a different thread
+  /** If publishing is enabled, the pose is published after every update without locking,
+    * so this method may be called by any number of threads while one thread updates.
+    * GetPose must only be used from the updating thread.
+    * @return The pose after the latest completed update while publishing was enabled
     */
-  const tPose & GetPose() const;
+  tPose GetPublishedPose() const;
+
+  //! Select how UpdatePose integrates long intervals
+  /** With bunched sensor messages the elapsed time can be much longer than the sensor period,
+    * and the single step of eDRIM_TRAPEZOID becomes inaccurate in tight turns. The other methods split
+    * such intervals into steps of at most maximum_step, with the twist changing linearly in between.
+    * Note that they take the orientation part of the twist as angular velocity in the local frame
+    * (see tIntegrationMethod).
+    * @param method The integration method, eDRIM_TRAPEZOID by default
+    * @param maximum_step The maximum duration of one step
+    */
+  void SetIntegrationMethod(tIntegrationMethod method, const rrlib::time::tDuration &maximum_step = std::chrono::milliseconds(10));
+
+  //! Set the number of twists kept for timestamped updates
+  /** A late twist can only be inserted if it is not older than the oldest twist in the history.
+    * Each entry holds a twist and a pose with their covariances, and the history is allocated
+    * here and not while updating. Setting the capacity clears the history.
+    * @param capacity The number of twists to keep, 100 by default
+    */
+  void SetHistoryCapacity(size_t capacity);
 
   //! Reset the internal twist.
   /** By calling this method, the previous twist will be marked as invalid and thus not used for integration.
+    * The history of timestamped updates is cleared as well.
     */
   void ResetTwist();
 
@@ -99,46 +188,191 @@ public:
     */
   void UpdatePose(const tTwist &twist, const rrlib::time::tDuration &elapsed_time);
 
+  //! Update the internal pose using a timestamped twist
+  /** The twist is inserted into the history in temporal order. The first twist only starts
+    * the integration. A twist with the timestamp of one in the history replaces it.
+    * If the twist is newer than all others this is as cheap as a normal update. Otherwise
+    * all n newer entries are moved by one and the updates after it are replayed from the
+    * checkpoint before it, i.e. a late twist costs O(n) entry copies and n updates.
+    * Mixing this with the update above clears the history.
+    *
+    * @param twist The linear and angular velocities
+    * @param timestamp The time the twist was measured at
+    * @return Whether the twist was used, i.e. false if it is older than the history
+    */
+  bool UpdatePose(const tTwist &twist, const rrlib::time::tTimestamp &timestamp);
+
   //! Update the specified pose using the twist as well as the elapsed time
   /** This is a static member and thus needs no object to operate on.
     * As the previous twist is not known in this method, the integration can only be approximated using the midpoint rule (also called rectangle rule).
     * For more precise results, use the method that also takes the previous twist into account.
+    * The covariance of the pose is propagated to first order, adding the uncertainty of the twist.
     *
     * @param pose The pose to be updated
     * @param twist The linear and angular velocities
     * @param elapsed_time The elapsed time
     */
-  static void UpdatePose(tPose &pose, const tTwist &twist, const rrlib::time::tDuration &elapsed_time);
+  static void UpdatePose(tAccumulatedPose &pose, const tTwist &twist, const rrlib::time::tDuration &elapsed_time);
 
   //! Update the specified pose using the twist as well as the elapsed time
   /** This is a static member and thus needs no object to operate on.
     * This method takes the previous twist into account to be able to approximate the integral using the trapezoidal rule.
+    * The two twists are assumed to be independent when averaging their covariances.
     *
     * @param pose The pose to be updated
     * @param previous_twist The linear and angular velocities of the previous time-step
     * @param twist The current linear and angular velocities
     * @param elapsed_time The elapsed time
     */
-  static void UpdatePose(tPose &pose, const tTwist &previous_twist, const tTwist &twist, const rrlib::time::tDuration &elapsed_time);
+  static void UpdatePose(tAccumulatedPose &pose, const tTwist &previous_twist, const tTwist &twist, const rrlib::time::tDuration &elapsed_time);
+
+  //! Update the specified pose using the twist, the elapsed time and the specified integration method
+  /** The twist is assumed to be constant during elapsed_time. If the twist does not change between
+    * the steps, the motion of one step is computed once and reused for all steps.
+    * The covariance is propagated over the whole interval like in the methods above.
+    *
+    * @param pose The pose to be updated
+    * @param twist The linear and angular velocities
+    * @param elapsed_time The elapsed time
+    * @param method The integration method
+    * @param maximum_step The maximum duration of one step
+    */
+  static void UpdatePose(tAccumulatedPose &pose, const tTwist &twist, const rrlib::time::tDuration &elapsed_time, tIntegrationMethod method, const rrlib::time::tDuration &maximum_step);
+
+  //! Update the specified pose using the previous and current twist, the elapsed time and the specified integration method
+  /** The twist is assumed to change linearly from previous_twist to twist during elapsed_time.
+    *
+    * @param pose The pose to be updated
+    * @param previous_twist The linear and angular velocities of the previous time-step
+    * @param twist The current linear and angular velocities
+    * @param elapsed_time The elapsed time
+    * @param method The integration method
+    * @param maximum_step The maximum duration of one step
+    */
+  static void UpdatePose(tAccumulatedPose &pose, const tTwist &previous_twist, const tTwist &twist, const rrlib::time::tDuration &elapsed_time, tIntegrationMethod method, const rrlib::time::tDuration &maximum_step);
+
+  //! Update the specified pose without covariance using the twist as well as the elapsed time
+  /** This is the kernel for callers that only need the mean, e.g. odometry on a vehicle.
+    * In contrast to the methods above, the twist is integrated with the exponential map,
+    * i.e. the pose moves on a helix (an arc in the plane), which is exact for a constant twist.
+    * Besides the relative transformation on the stack, no poses or matrices are created.
+    *
+    * @param pose The pose to be updated
+    * @param twist The linear and angular velocities
+    * @param elapsed_time The elapsed time
+    */
+  static void UpdateMean(tMeanPose &pose, const tMeanTwist &twist, const rrlib::time::tDuration &elapsed_time);
+
+  //! Update the specified pose without covariance using the mean of the previous and the current twist
+  /** @param pose The pose to be updated
+    * @param previous_twist The linear and angular velocities of the previous time-step
+    * @param twist The current linear and angular velocities
+    * @param elapsed_time The elapsed time
+    */
+  static void UpdateMean(tMeanPose &pose, const tMeanTwist &previous_twist, const tMeanTwist &twist, const rrlib::time::tDuration &elapsed_time);
+
+  //! Update a set of particles, each with its own twist
+  /** This is meant for particle filters, where the spread of the particles
+    * represents the uncertainty and no covariances are needed. The twists
+    * are scaled lane by lane in loops the compiler vectorises, and the
+    * composition runs in the kernel of tPoseArray3D.
+    * The relative transformations are written to an array of the caller, so
+    * that repeated updates of the same particle set do not allocate memory.
+    *
+    * @param poses The poses to be updated
+    * @param twists The linear and angular velocities, one per pose
+    * @param elapsed_time The elapsed time
+    * @param relative_transformations Scratch array that is resized to the number of poses
+    */
+  static void UpdatePoses(tPoseArray &poses, const tTwistArray &twists, const rrlib::time::tDuration &elapsed_time, tPoseArray &relative_transformations);
 
 //----------------------------------------------------------------------
 // Private fields and methods
 //----------------------------------------------------------------------
 private:
 
-  tPose pose;
+  tAccumulatedPose pose;
   tTwist previous_twist;
 
+  //! Copy of pose for readers in other threads
+  tSharedPose<tPose> published_pose;
+  bool publish_pose;
+
   //! Indicates whether the previous twist is available, i.e. if we have been updated at least once
   bool previous_twist_available;
 
+  tIntegrationMethod integration_method;
+  rrlib::time::tDuration maximum_step;
+
+  //! A twist of a timestamped update together with the pose at its time
+  struct tHistoryEntry
+  {
+    rrlib::time::tTimestamp timestamp;
+    tTwist twist;
+    tAccumulatedPose pose;
+  };
+
+  //! Ring buffer of timestamped updates with one spare entry for the insertion
+  std::vector<tHistoryEntry> history;
+  size_t history_capacity;
+  size_t history_first;
+  size_t history_size;
+
+  inline tHistoryEntry &HistoryEntry(size_t index)
+  {
+    return this->history[(this->history_first + index) % this->history.size()];
+  }
+
+  inline void PublishPose()
+  {
+    if (this->publish_pose)
+    {
+      this->published_pose.Store(ConvertPose<tPose>(this->pose));
+    }
+  }
+
+  inline void ClearHistory()
+  {
+    this->history_first = 0;
+    this->history_size = 0;
+  }
+
+  //! Integrate the motion in steps and compound the result with the mean of both twist covariances scaled by covariance_factor
+  static void IntegrateSteps(tAccumulatedPose &pose, const tTwist &previous_twist, const tTwist &twist, TElement covariance_factor, const rrlib::time::tDuration &elapsed_time, tIntegrationMethod method, const rrlib::time::tDuration &maximum_step);
+
+  //! Convert between the element types of the interface and the accumulator, including the covariance
+  template <typename TTargetPose, typename TSourcePose>
+  static TTargetPose ConvertPose(const TSourcePose &pose)
+  {
+    return ConvertPose<TTargetPose>(pose, std::is_same<TTargetPose, TSourcePose>());
+  }
+  template <typename TTargetPose>
+  static const TTargetPose &ConvertPose(const TTargetPose &pose, std::true_type)
+  {
+    return pose;
+  }
+  template <typename TTargetPose, typename TSourcePose>
+  static TTargetPose ConvertPose(const TSourcePose &pose, std::false_type);
+
 };
 
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tGenericDeadReckoning<double>;
+extern template class tGenericDeadReckoning<float>;
+extern template class tGenericDeadReckoning<float, double>;
+
+//! Dead reckoning with poses and twists in double, the interface this class had before it was templated
+typedef tGenericDeadReckoning<double> tDeadReckoning;
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
 }
 }
 
+#include "rrlib/localization/tDeadReckoning.hpp"
 
 #endif
@@ -0,0 +1,426 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tDeadReckoning.hpp
+ *
+ * \author  Michael Arndt
+ *
+ * \date    2014-06-05
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+template <typename TElement, typename TAccumulatorElement>
+tGenericDeadReckoning<TElement, TAccumulatorElement>::tGenericDeadReckoning(const tPose &initial_pose) : pose(ConvertPose<tAccumulatedPose>(initial_pose)), published_pose(initial_pose), publish_pose(false), previous_twist_available(false),
+  integration_method(eDRIM_TRAPEZOID), maximum_step(std::chrono::milliseconds(10)),
+  history_capacity(100), history_first(0), history_size(0)
+{
+  // the history is allocated here so that timestamped updates do not allocate
+  this->history.resize(this->history_capacity + 1);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::SetPose(const tPose &pose)
+{
+  this->pose = ConvertPose<tAccumulatedPose>(pose);
+  this->PublishPose();
+  this->ClearHistory();
+}
+
+template <typename TElement, typename TAccumulatorElement>
+const typename tGenericDeadReckoning<TElement, TAccumulatorElement>::tAccumulatedPose & tGenericDeadReckoning<TElement, TAccumulatorElement>::GetPose() const
+{
+  return this->pose;
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::SetPublishPose(bool publish)
+{
+  this->publish_pose = publish;
+  this->PublishPose();
+}
+
+template <typename TElement, typename TAccumulatorElement>
+typename tGenericDeadReckoning<TElement, TAccumulatorElement>::tPose tGenericDeadReckoning<TElement, TAccumulatorElement>::GetPublishedPose() const
+{
+  return this->published_pose.Load();
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::SetIntegrationMethod(tIntegrationMethod method, const rrlib::time::tDuration &maximum_step)
+{
+  assert(maximum_step > rrlib::time::tDuration::zero());
+  this->integration_method = method;
+  this->maximum_step = maximum_step;
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::SetHistoryCapacity(size_t capacity)
+{
+  assert(capacity > 0);
+  this->history_capacity = capacity;
+  this->history.resize(capacity + 1);
+  this->ClearHistory();
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::ResetTwist()
+{
+  this->previous_twist = tTwist();
+  this->previous_twist_available = false;
+  this->ClearHistory();
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdatePose(const tTwist &twist, const rrlib::time::tDuration &elapsed_time)
+{
+  if (previous_twist_available)
+    UpdatePose(this->pose, this->previous_twist, twist, elapsed_time, this->integration_method, this->maximum_step);
+  else
+    UpdatePose(this->pose, twist, elapsed_time, this->integration_method, this->maximum_step);
+
+  previous_twist = twist;
+  previous_twist_available = true;
+  this->ClearHistory();
+
+  this->PublishPose();
+}
+
+template <typename TElement, typename TAccumulatorElement>
+bool tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdatePose(const tTwist &twist, const rrlib::time::tTimestamp &timestamp)
+{
+  if (this->history_size > 0 && timestamp < this->HistoryEntry(0).timestamp)
+  {
+    return false;
+  }
+
+  // late twists are rare and usually only a few entries behind, so search from the newest one
+  size_t index = this->history_size;
+  while (index > 0 && timestamp < this->HistoryEntry(index - 1).timestamp)
+  {
+    --index;
+  }
+
+  size_t replay_begin;
+  if (index > 0 && this->HistoryEntry(index - 1).timestamp == timestamp)
+  {
+    replay_begin = index - 1;
+    this->HistoryEntry(replay_begin).twist = twist;
+  }
+  else
+  {
+    ++this->history_size;
+    for (size_t i = this->history_size - 1; i > index; --i)
+    {
+      this->HistoryEntry(i) = this->HistoryEntry(i - 1);
+    }
+    tHistoryEntry &entry = this->HistoryEntry(index);
+    entry.timestamp = timestamp;
+    entry.twist = twist;
+    if (index == 0)
+    {
+      // the first twist of the history, which starts at the current pose
+      entry.pose = this->pose;
+    }
+    replay_begin = index;
+  }
+
+  // the pose of the oldest entry is where the history starts and is never integrated
+  for (size_t i = std::max<size_t>(replay_begin, 1); i < this->history_size; ++i)
+  {
+    const tHistoryEntry &previous = this->HistoryEntry(i - 1);
+    tHistoryEntry &current = this->HistoryEntry(i);
+    current.pose = previous.pose;
+    UpdatePose(current.pose, previous.twist, current.twist, current.timestamp - previous.timestamp, this->integration_method, this->maximum_step);
+  }
+
+  if (this->history_size > this->history_capacity)
+  {
+    this->history_first = (this->history_first + 1) % this->history.size();
+    --this->history_size;
+  }
+
+  const tHistoryEntry &newest = this->HistoryEntry(this->history_size - 1);
+  this->pose = newest.pose;
+  this->previous_twist = newest.twist;
+  this->previous_twist_available = true;
+
+  this->PublishPose();
+  return true;
+}
+
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdatePose(tAccumulatedPose &pose, const tTwist &twist, const rrlib::time::tDuration &elapsed_time)
+{
+  rrlib::si_units::tTime<TAccumulatorElement> elapsed(std::chrono::duration_cast<std::chrono::duration<TAccumulatorElement>>(elapsed_time).count());
+
+  auto relative_transformation = twist * elapsed;
+  const TAccumulatorElement squared_elapsed_time = elapsed.Value() * elapsed.Value();
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      relative_transformation.Covariance()[i][j] = squared_elapsed_time * twist.Covariance()[i][j];
+    }
+  }
+  pose.Compound(relative_transformation);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdatePose(tAccumulatedPose &pose, const tTwist &previous_twist, const tTwist &twist, const rrlib::time::tDuration &elapsed_time)
+{
+  // do the trapezoidal calculation
+  tTwist average_twist = (previous_twist + twist) * static_cast<TElement>(0.5);
+  // the mean of two independent twists
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      average_twist.Covariance()[i][j] = static_cast<TElement>(0.25) * (previous_twist.Covariance()[i][j] + twist.Covariance()[i][j]);
+    }
+  }
+  UpdatePose(pose, average_twist, elapsed_time);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdatePose(tAccumulatedPose &pose, const tTwist &twist, const rrlib::time::tDuration &elapsed_time, tIntegrationMethod method, const rrlib::time::tDuration &maximum_step)
+{
+  if (method == eDRIM_TRAPEZOID)
+  {
+    UpdatePose(pose, twist, elapsed_time);
+    return;
+  }
+  // the same twist twice: 0.5 * (sigma + sigma) = sigma
+  IntegrateSteps(pose, twist, twist, static_cast<TElement>(0.5), elapsed_time, method, maximum_step);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdatePose(tAccumulatedPose &pose, const tTwist &previous_twist, const tTwist &twist, const rrlib::time::tDuration &elapsed_time, tIntegrationMethod method, const rrlib::time::tDuration &maximum_step)
+{
+  if (method == eDRIM_TRAPEZOID)
+  {
+    UpdatePose(pose, previous_twist, twist, elapsed_time);
+    return;
+  }
+  // the mean of two independent twists like in the trapezoidal calculation
+  IntegrateSteps(pose, previous_twist, twist, static_cast<TElement>(0.25), elapsed_time, method, maximum_step);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::IntegrateSteps(tAccumulatedPose &pose, const tTwist &previous_twist, const tTwist &twist, TElement covariance_factor, const rrlib::time::tDuration &elapsed_time, tIntegrationMethod method, const rrlib::time::tDuration &maximum_step)
+{
+  if (elapsed_time <= rrlib::time::tDuration::zero())
+  {
+    return;
+  }
+  assert(maximum_step > rrlib::time::tDuration::zero());
+
+  // the conversion to seconds is done in double to keep the resolution of the duration
+  const TAccumulatorElement elapsed = static_cast<TAccumulatorElement>(std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count());
+  const size_t number_of_steps = static_cast<size_t>((elapsed_time + maximum_step - rrlib::time::tDuration(1)) / maximum_step);
+  const TAccumulatorElement step = elapsed / number_of_steps;
+
+  const TAccumulatorElement start[6] =
+  {
+    previous_twist.X().Value(), previous_twist.Y().Value(), previous_twist.Z().Value(),
+    previous_twist.Roll().Value().Value(), previous_twist.Pitch().Value().Value(), previous_twist.Yaw().Value().Value()
+  };
+  const TAccumulatorElement end[6] =
+  {
+    twist.X().Value(), twist.Y().Value(), twist.Z().Value(),
+    twist.Roll().Value().Value(), twist.Pitch().Value().Value(), twist.Yaw().Value().Value()
+  };
+  TAccumulatorElement change[6];
+  bool constant_twist = true;
+  for (size_t i = 0; i < 6; ++i)
+  {
+    change[i] = end[i] - start[i];
+    constant_twist &= change[i] == 0;
+  }
+  // linear interpolation of the twist at fraction s of the interval
+  auto interpolate = [&start, &change](TAccumulatorElement s, TAccumulatorElement(&velocity)[3], TAccumulatorElement(&omega)[3])
+  {
+    for (size_t i = 0; i < 3; ++i)
+    {
+      velocity[i] = start[i] + s * change[i];
+      omega[i] = start[i + 3] + s * change[i + 3];
+    }
+  };
+
+  // rotation and position of the relative transformation accumulated over all steps
+  TAccumulatorElement rotation[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+  TAccumulatorElement position[3] = { 0, 0, 0 };
+  TAccumulatorElement step_rotation[3][3];
+  TAccumulatorElement step_position[3];
+  TAccumulatorElement temporary[3][3];
+  for (size_t k = 0; k < number_of_steps; ++k)
+  {
+    // the motion of one step along the exponential map, reused while the twist is constant
+    if (k == 0 || !constant_twist)
+    {
+      TAccumulatorElement velocity[3], omega[3], jacobian[3][3];
+      if (method == eDRIM_SUB_STEPS)
+      {
+        // the twist in the middle of the step
+        interpolate((k + static_cast<TAccumulatorElement>(0.5)) / number_of_steps, velocity, omega);
+      }
+      else
+      {
+        // Runge-Kutta-Munthe-Kaas: as the twist does not depend on the pose, the stages reduce to Simpson's rule
+        // plus the commutator of the twists at both ends of the step, which is exact for a constant twist
+        TAccumulatorElement velocity_begin[3], omega_begin[3], velocity_middle[3], omega_middle[3], velocity_end[3], omega_end[3];
+        interpolate(static_cast<TAccumulatorElement>(k) / number_of_steps, velocity_begin, omega_begin);
+        interpolate((k + static_cast<TAccumulatorElement>(0.5)) / number_of_steps, velocity_middle, omega_middle);
+        interpolate(static_cast<TAccumulatorElement>(k + 1) / number_of_steps, velocity_end, omega_end);
+        for (size_t i = 0; i < 3; ++i)
+        {
+          const size_t j = (i + 1) % 3;
+          const size_t l = (i + 2) % 3;
+          const TAccumulatorElement velocity_commutator = omega_begin[j] * velocity_end[l] - omega_begin[l] * velocity_end[j] - omega_end[j] * velocity_begin[l] + omega_end[l] * velocity_begin[j];
+          const TAccumulatorElement omega_commutator = omega_begin[j] * omega_end[l] - omega_begin[l] * omega_end[j];
+          velocity[i] = (velocity_begin[i] + 4 * velocity_middle[i] + velocity_end[i]) / 6 + step / 12 * velocity_commutator;
+          omega[i] = (omega_begin[i] + 4 * omega_middle[i] + omega_end[i]) / 6 + step / 12 * omega_commutator;
+        }
+      }
+      for (size_t i = 0; i < 3; ++i)
+      {
+        velocity[i] *= step;
+        omega[i] *= step;
+      }
+      localization::pose::ExponentialSO3(omega, step_rotation, jacobian);
+      for (size_t i = 0; i < 3; ++i)
+      {
+        step_position[i] = jacobian[i][0] * velocity[0] + jacobian[i][1] * velocity[1] + jacobian[i][2] * velocity[2];
+      }
+    }
+    for (size_t i = 0; i < 3; ++i)
+    {
+      position[i] += rotation[i][0] * step_position[0] + rotation[i][1] * step_position[1] + rotation[i][2] * step_position[2];
+    }
+    orientation::Multiply(temporary, rotation, step_rotation);
+    std::copy(&temporary[0][0], &temporary[0][0] + 9, &rotation[0][0]);
+  }
+
+  typedef typename tAccumulatedPose::template tOrientationComponent<> tAngle;
+  TAccumulatorElement roll, pitch, yaw;
+  orientation::ExtractRollPitchYaw(rotation, roll, pitch, yaw);
+  tAccumulatedPose relative_transformation;
+  relative_transformation.Set(position[0], position[1], position[2], tAngle(roll), tAngle(pitch), tAngle(yaw));
+  const TAccumulatorElement scale = elapsed * elapsed * covariance_factor;
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      relative_transformation.Covariance()[i][j] = scale * (previous_twist.Covariance()[i][j] + twist.Covariance()[i][j]);
+    }
+  }
+  pose.Compound(relative_transformation);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdateMean(tMeanPose &pose, const tMeanTwist &twist, const rrlib::time::tDuration &elapsed_time)
+{
+  // the conversion to seconds is done in double to keep the resolution of the duration
+  const rrlib::si_units::tTime<TAccumulatorElement> elapsed(static_cast<TAccumulatorElement>(std::chrono::duration_cast<std::chrono::duration<double>>(elapsed_time).count()));
+  pose.ApplyRelativePoseTransformation(localization::Exp(twist * elapsed));
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdateMean(tMeanPose &pose, const tMeanTwist &previous_twist, const tMeanTwist &twist, const rrlib::time::tDuration &elapsed_time)
+{
+  UpdateMean(pose, (previous_twist + twist) * static_cast<TElement>(0.5), elapsed_time);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+void tGenericDeadReckoning<TElement, TAccumulatorElement>::UpdatePoses(tPoseArray &poses, const tTwistArray &twists, const rrlib::time::tDuration &elapsed_time, tPoseArray &relative_transformations)
+{
+  assert(twists.Size() == poses.Size());
+  const TElement elapsed = std::chrono::duration_cast<std::chrono::duration<TElement>>(elapsed_time).count();
+  const size_t size = twists.Size();
+  relative_transformations.Resize(size);
+  for (size_t lane = 0; lane < tPoseArray::cLANES; ++lane)
+  {
+    const TElement *twist = twists.Lane(lane);
+    TElement *relative_transformation = relative_transformations.Lane(lane);
+    for (size_t i = 0; i < size; ++i)
+    {
+      relative_transformation[i] = twist[i] * elapsed;
+    }
+  }
+  poses.ApplyRelativePoseTransformation(relative_transformations);
+}
+
+template <typename TElement, typename TAccumulatorElement>
+template <typename TTargetPose, typename TSourcePose>
+TTargetPose tGenericDeadReckoning<TElement, TAccumulatorElement>::ConvertPose(const TSourcePose &pose, std::false_type)
+{
+  TTargetPose result(pose);
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      result.Covariance()[i][j] = pose.Covariance()[i][j];
+    }
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
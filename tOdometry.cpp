@@ -54,6 +54,16 @@ namespace localization
 // Forward class declarations
 // Extern methods
 //----------------------------------------------------------------------
+namespace
+{
+//! unicycle model with side slip: derivative of x, y and yaw for the given yaw
+inline void GetUnicycleDerivative(double yaw, double velocity, double angular_velocity, double side_slip_angle, double derivative[3])
+{
+  derivative[0] = velocity * cos(yaw + side_slip_angle);
+  derivative[1] = velocity * sin(yaw + side_slip_angle);
+  derivative[2] = angular_velocity;
+}
+}
 
 //----------------------------------------------------------------------
 // class tOdometry constructor
@@ -61,15 +71,18 @@ namespace localization
 tOdometry::tOdometry(bool _use_timestamp, math::tPose3D _initial_pose)
   :
   pose_changed(0),
-  vel_veh(0.0f),
-  av_z_veh(0.0f),
-  side_slip_angle(0.0f),
+  vel_veh(0.0),
+  av_z_veh(0.0),
+  side_slip_angle(0.0),
+  previous_velocities_available(false),
   elapsed_time(0.0f),
   timer(),
   data_select(0),
   reset(false),
   use_timestamp(_use_timestamp),
   reset_timer(true),
+  use_planar_fast_path(true),
+  integration_method(eOIM_EXACT_ARC),
   data_changed(0),
   current_pose_wcs(_initial_pose),
   previous_pose_wcs(_initial_pose),
@@ -79,7 +92,6 @@ tOdometry::tOdometry(bool _use_timestamp, math::tPose3D _initial_pose)
   vel_vector_lcs(math::tPose3D::Zero()),
   vel_vector_wcs(math::tPose3D::Zero()),
   av_vector_wcs(math::tPose3D::Zero()),
-  local_side_slip_rotation(math::tPose3D::Zero()),
   previous_pose_wcs_matrix(math::tMat4x4d::Identity())
 {}
 
@@ -156,66 +168,26 @@ bool tOdometry::UpdatePose(double vel_veh, double av_z_veh, double side_slip_ang
   {
     this->current_pose_wcs.Reset();
     this->previous_pose_wcs.Reset();
+    this->previous_velocities_available = false;
     return false;
   }
   else
   {
     if (elapsed_time > 0)
     {
-      //@todo: add trapez calculation for improvement
-
-      //first reset poses:
-      this->delta_pose_lcs.Reset();
-      this->vel_vector_lcs.Reset();
-      this->vel_vector_wcs.Reset();
-      this->av_vector_wcs.Reset();
-      this->local_side_slip_rotation.Reset();
-      this->velocity_conversion.Reset();
-
-      //pose containing the angular offset due to the side slip angle:
-      this->local_side_slip_rotation.SetOrientation(math::tAngleRad(0.0), math::tAngleRad(0.0), math::tAngleRad(side_slip_angle));
+      //pose change in the frame of the vehicle at the beginning of the interval, side slip included:
+      double delta_x, delta_y, delta_yaw;
+      this->IntegrateLocalMotion(vel_veh, av_z_veh, side_slip_angle, delta_x, delta_y, delta_yaw);
 
-      //calculate local pose change and velocity vector
-      if (av_z_veh != 0.)
+      if (this->use_planar_fast_path && math::tAngleRad(this->current_pose_wcs.Roll()).Value() == 0 && math::tAngleRad(this->current_pose_wcs.Pitch()).Value() == 0)
       {
-        this->delta_pose_lcs.Set(
-          vel_veh / av_z_veh * sin(av_z_veh * elapsed_time),
-          vel_veh / av_z_veh * (1. - cos(av_z_veh * elapsed_time)),
-          this->delta_pose_lcs.Z());
-        this->vel_vector_lcs.Set(
-          this->delta_pose_lcs.X() / elapsed_time,
-          this->delta_pose_lcs.Y() / elapsed_time,
-          this->vel_vector_lcs.Z());
+        this->UpdatePosePlanar(delta_x, delta_y, delta_yaw, side_slip_angle);
       }
       else
       {
-        this->delta_pose_lcs.Set(vel_veh * elapsed_time, this->delta_pose_lcs.Y(), this->delta_pose_lcs.Z());
-        this->vel_vector_lcs.Set(vel_veh, this->vel_vector_lcs.Y(), this->vel_vector_lcs.Z());
+        this->UpdatePoseGeneral(delta_x, delta_y, delta_yaw, side_slip_angle);
       }
 
-      //rotate vectors in lcs according to side slip:
-      math::tMat4x4d local_side_slip_rotation_matrix = local_side_slip_rotation.GetTransformationMatrix();
-      this->delta_pose_lcs.Set(local_side_slip_rotation_matrix * delta_pose_lcs.GetTransformationMatrix(), false);
-      this->vel_vector_lcs.Set(local_side_slip_rotation_matrix * vel_vector_lcs.GetTransformationMatrix(), false);
-
-      //after the orientation of the vector is correct, set the rotation:
-      this->delta_pose_lcs.SetOrientation(
-        delta_pose_lcs.Roll(),
-        delta_pose_lcs.Pitch(),
-        math::tAngleRad(av_z_veh * elapsed_time));
-
-      //velocity conversion vector: only rotation
-      velocity_conversion = current_pose_wcs;
-      velocity_conversion.Set(0., 0., 0.);
-
-      math::tMat4x4d current_pose_wcs_matrix = current_pose_wcs.GetTransformationMatrix();
-
-      this->vel_vector_wcs.Set(this->velocity_conversion.GetTransformationMatrix() * vel_vector_lcs.GetTransformationMatrix(), false);
-
-      this->previous_pose_wcs.Set(current_pose_wcs_matrix, false);
-      current_pose_wcs_matrix *= delta_pose_lcs.GetTransformationMatrix();
-      this->current_pose_wcs.Set(current_pose_wcs_matrix, false);
-
       //use difference to determine angular velocities:
       av_vector_wcs.SetOrientation(
         math::tAngleRad(current_pose_wcs.Roll() - previous_pose_wcs.Roll()) / elapsed_time,
@@ -223,10 +195,135 @@ bool tOdometry::UpdatePose(double vel_veh, double av_z_veh, double side_slip_ang
         math::tAngleRad(current_pose_wcs.Yaw() - previous_pose_wcs.Yaw()) / elapsed_time);
       this->data_changed = (this->data_changed + 1) % 1000;
     }
+
+    this->vel_veh = vel_veh;
+    this->av_z_veh = av_z_veh;
+    this->side_slip_angle = side_slip_angle;
+    this->previous_velocities_available = true;
     return true;
   }
 } // UpdatePose()
 
+//----------------------------------------------------------------------
+// class tOdometry IntegrateLocalMotion()
+//----------------------------------------------------------------------
+void tOdometry::IntegrateLocalMotion(double vel_veh, double av_z_veh, double side_slip_angle, double &delta_x, double &delta_y, double &delta_yaw) const
+{
+  //velocities at the beginning of the interval, the current ones are those at its end
+  const double previous_vel_veh = this->previous_velocities_available ? this->vel_veh : vel_veh;
+  const double previous_av_z_veh = this->previous_velocities_available ? this->av_z_veh : av_z_veh;
+  const double previous_side_slip_angle = this->previous_velocities_available ? this->side_slip_angle : side_slip_angle;
+
+  if (this->integration_method == eOIM_MIDPOINT || this->integration_method == eOIM_RUNGE_KUTTA)
+  {
+    const double h = elapsed_time;
+    const double mid_vel_veh = 0.5 * (previous_vel_veh + vel_veh);
+    const double mid_av_z_veh = 0.5 * (previous_av_z_veh + av_z_veh);
+    const double mid_side_slip_angle = 0.5 * (previous_side_slip_angle + side_slip_angle);
+
+    //the derivative does not depend on x and y, so only yaw is needed for the stages
+    double k1[3], k2[3];
+    GetUnicycleDerivative(0., previous_vel_veh, previous_av_z_veh, previous_side_slip_angle, k1);
+    GetUnicycleDerivative(0.5 * h * k1[2], mid_vel_veh, mid_av_z_veh, mid_side_slip_angle, k2);
+    if (this->integration_method == eOIM_MIDPOINT)
+    {
+      delta_x = h * k2[0];
+      delta_y = h * k2[1];
+      delta_yaw = h * k2[2];
+      return;
+    }
+
+    double k3[3], k4[3];
+    GetUnicycleDerivative(0.5 * h * k2[2], mid_vel_veh, mid_av_z_veh, mid_side_slip_angle, k3);
+    GetUnicycleDerivative(h * k3[2], vel_veh, av_z_veh, side_slip_angle, k4);
+    delta_x = h / 6. * (k1[0] + 2. * k2[0] + 2. * k3[0] + k4[0]);
+    delta_y = h / 6. * (k1[1] + 2. * k2[1] + 2. * k3[1] + k4[1]);
+    delta_yaw = h / 6. * (k1[2] + 2. * k2[2] + 2. * k3[2] + k4[2]);
+    return;
+  }
+
+  if (this->integration_method == eOIM_TRAPEZOID)
+  {
+    vel_veh = 0.5 * (previous_vel_veh + vel_veh);
+    av_z_veh = 0.5 * (previous_av_z_veh + av_z_veh);
+    side_slip_angle = 0.5 * (previous_side_slip_angle + side_slip_angle);
+  }
+
+  //circular arc with constant velocities
+  double arc_x = vel_veh * elapsed_time;
+  double arc_y = 0.;
+  if (av_z_veh != 0.)
+  {
+    arc_x = vel_veh / av_z_veh * sin(av_z_veh * elapsed_time);
+    arc_y = vel_veh / av_z_veh * (1. - cos(av_z_veh * elapsed_time));
+  }
+
+  //rotate according to side slip:
+  const double sin_side_slip = sin(side_slip_angle);
+  const double cos_side_slip = cos(side_slip_angle);
+  delta_x = cos_side_slip * arc_x - sin_side_slip * arc_y;
+  delta_y = sin_side_slip * arc_x + cos_side_slip * arc_y;
+  delta_yaw = av_z_veh * elapsed_time;
+} // IntegrateLocalMotion()
+
+//----------------------------------------------------------------------
+// class tOdometry UpdatePoseGeneral()
+//----------------------------------------------------------------------
+void tOdometry::UpdatePoseGeneral(double delta_x, double delta_y, double delta_yaw, double side_slip_angle)
+{
+  //first reset poses:
+  this->delta_pose_lcs.Reset();
+  this->vel_vector_lcs.Reset();
+  this->vel_vector_wcs.Reset();
+  this->av_vector_wcs.Reset();
+  this->velocity_conversion.Reset();
+
+  //local pose change and mean velocity vector, which carries the side slip rotation:
+  this->delta_pose_lcs.Set(delta_x, delta_y, 0.);
+  this->delta_pose_lcs.SetOrientation(math::tAngleRad(0.0), math::tAngleRad(0.0), math::tAngleRad(delta_yaw));
+  this->vel_vector_lcs.Set(delta_x / elapsed_time, delta_y / elapsed_time, 0.);
+  this->vel_vector_lcs.SetOrientation(math::tAngleRad(0.0), math::tAngleRad(0.0), math::tAngleRad(side_slip_angle));
+
+  //velocity conversion vector: only rotation
+  velocity_conversion = current_pose_wcs;
+  velocity_conversion.Set(0., 0., 0.);
+
+  math::tMat4x4d current_pose_wcs_matrix = current_pose_wcs.GetTransformationMatrix();
+
+  this->vel_vector_wcs.Set(this->velocity_conversion.GetTransformationMatrix() * vel_vector_lcs.GetTransformationMatrix(), false);
+
+  this->previous_pose_wcs.Set(current_pose_wcs_matrix, false);
+  current_pose_wcs_matrix *= delta_pose_lcs.GetTransformationMatrix();
+  this->current_pose_wcs.Set(current_pose_wcs_matrix, false);
+} // UpdatePoseGeneral()
+
+//----------------------------------------------------------------------
+// class tOdometry UpdatePosePlanar()
+//----------------------------------------------------------------------
+void tOdometry::UpdatePosePlanar(double delta_x, double delta_y, double delta_yaw, double side_slip_angle)
+{
+  //same as UpdatePoseGeneral with roll = pitch = 0, so all rotations are about z
+  const double yaw = math::tAngleRad(this->current_pose_wcs.Yaw()).Value();
+  const double sin_yaw = sin(yaw);
+  const double cos_yaw = cos(yaw);
+
+  //the velocity vector carries the rotation it was converted with, as in the matrix version
+  this->vel_vector_wcs.Reset();
+  this->vel_vector_wcs.Set(
+    (cos_yaw * delta_x - sin_yaw * delta_y) / elapsed_time,
+    (sin_yaw * delta_x + cos_yaw * delta_y) / elapsed_time,
+    0.);
+  this->vel_vector_wcs.SetOrientation(math::tAngleRad(0.0), math::tAngleRad(0.0), math::tAngleRad(yaw + side_slip_angle));
+  this->av_vector_wcs.Reset();
+
+  this->previous_pose_wcs = this->current_pose_wcs;
+  this->current_pose_wcs.Set(
+    this->current_pose_wcs.X() + cos_yaw * delta_x - sin_yaw * delta_y,
+    this->current_pose_wcs.Y() + sin_yaw * delta_x + cos_yaw * delta_y,
+    this->current_pose_wcs.Z());
+  this->current_pose_wcs.SetOrientation(math::tAngleRad(0.0), math::tAngleRad(0.0), math::tAngleRad(yaw + delta_yaw));
+} // UpdatePosePlanar()
+
 //----------------------------------------------------------------------
 // Namespace declaration
 //----------------------------------------------------------------------
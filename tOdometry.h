@@ -74,6 +74,19 @@ namespace localization
 class tOdometry
 {
 public:
+  /*!
+    How the motion between two calls of UpdatePose is integrated.
+    The previous velocities are those of the last call of UpdatePose;
+    in between, the velocities are interpolated linearly.
+   */
+  enum tIntegrationMethod
+  {
+    eOIM_EXACT_ARC,   //!< Circular arc with the current velocities
+    eOIM_TRAPEZOID,   //!< Circular arc with the mean of the previous and the current velocities
+    eOIM_MIDPOINT,    //!< Midpoint rule with the interpolated velocities
+    eOIM_RUNGE_KUTTA  //!< Classical fourth order Runge-Kutta with the interpolated velocities
+  };
+
   /*!
    */
   tOdometry(
@@ -142,6 +155,31 @@ public:
 
   bool UpdatePose(double velocity, double angular_velocity, double side_slip_angle);
 
+  /*!
+    Planar vehicles (zero roll and pitch) are integrated with a few scalar
+    trig operations instead of 4x4 transformation matrices by default.
+    The results are the same within numerical precision.
+   */
+  bool UsePlanarFastPath() const
+  {
+    return this->use_planar_fast_path;
+  }
+
+  void SetUsePlanarFastPath(bool val)
+  {
+    this->use_planar_fast_path = val;
+  }
+
+  tIntegrationMethod IntegrationMethod() const
+  {
+    return this->integration_method;
+  }
+
+  void SetIntegrationMethod(tIntegrationMethod val)
+  {
+    this->integration_method = val;
+  }
+
   int DataChanged() const
   {
     return this->data_changed;
@@ -149,11 +187,19 @@ public:
 
 private:
 
+  void IntegrateLocalMotion(double velocity, double angular_velocity, double side_slip_angle, double &delta_x, double &delta_y, double &delta_yaw) const;
+
+  void UpdatePoseGeneral(double delta_x, double delta_y, double delta_yaw, double side_slip_angle);
+
+  void UpdatePosePlanar(double delta_x, double delta_y, double delta_yaw, double side_slip_angle);
+
   int pose_changed;
 
-  float vel_veh;
-  float av_z_veh;
-  float side_slip_angle;
+  //! velocities of the previous call of UpdatePose
+  double vel_veh;
+  double av_z_veh;
+  double side_slip_angle;
+  bool previous_velocities_available;
 
   float elapsed_time;
   util::tTime timer;
@@ -162,6 +208,8 @@ private:
   bool reset;
   bool use_timestamp;
   bool reset_timer;
+  bool use_planar_fast_path;
+  tIntegrationMethod integration_method;
 
   int data_changed;
 
@@ -169,7 +217,6 @@ private:
   math::tPose3D velocity_conversion;
   math::tPose3D vel_vector_lcs;
   math::tPose3D vel_vector_wcs, av_vector_wcs;
-  math::tPose3D local_side_slip_rotation;
   math::tMat4x4d previous_pose_wcs_matrix;
 };
 //----------------------------------------------------------------------
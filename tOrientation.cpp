@@ -75,6 +75,9 @@ template class tOrientation<3, float, si_units::tNoUnit, math::angle::Signed>;
 template class tOrientation<3, double, si_units::tHertz, math::angle::NoWrap>;
 template class tOrientation<3, float, si_units::tHertz, math::angle::NoWrap>;
 
+template class tQuaternionOrientation<double, math::angle::Signed>;
+template class tQuaternionOrientation<float, math::angle::Signed>;
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
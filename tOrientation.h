@@ -46,6 +46,7 @@
 
 #include "rrlib/localization/orientation/tOrientation2D.h"
 #include "rrlib/localization/orientation/tOrientation3D.h"
+#include "rrlib/localization/orientation/tQuaternionOrientation.h"
 
 #undef __rrlib__localization__orientation__include_guard__
 
@@ -147,6 +148,9 @@ extern template class tOrientation<3, float, si_units::tNoUnit, math::angle::Sig
 extern template class tOrientation<3, double, si_units::tHertz, math::angle::NoWrap>;
 extern template class tOrientation<3, float, si_units::tHertz, math::angle::NoWrap>;
 
+extern template class tQuaternionOrientation<double, math::angle::Signed>;
+extern template class tQuaternionOrientation<float, math::angle::Signed>;
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
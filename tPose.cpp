@@ -75,6 +75,17 @@ template class tPose<3, float, si_units::tMeter, si_units::tNoUnit, math::angle:
 template class tPose < 3, double, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 template class tPose < 3, float, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 
+template class tQuaternionPose<double, math::angle::Signed>;
+template class tQuaternionPose<float, math::angle::Signed>;
+
+template class tPoseWithCache<double, math::angle::Signed>;
+template class tPoseWithCache<float, math::angle::Signed>;
+
+template class tPoseArray<2, double, math::angle::Signed>;
+template class tPoseArray<2, float, math::angle::Signed>;
+template class tPoseArray<3, double, math::angle::Signed>;
+template class tPoseArray<3, float, math::angle::Signed>;
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
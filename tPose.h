@@ -43,6 +43,13 @@
 
 #include "rrlib/localization/pose/tPose2D.h"
 #include "rrlib/localization/pose/tPose3D.h"
+#include "rrlib/localization/pose/tQuaternionPose.h"
+#include "rrlib/localization/pose/tPoseWithCache.h"
+#include "rrlib/localization/pose/batch_transformation.h"
+#include "rrlib/localization/pose/exponential_map.h"
+#include "rrlib/localization/pose/interpolation.h"
+#include "rrlib/localization/pose/tPoseArray2D.h"
+#include "rrlib/localization/pose/tPoseArray3D.h"
 
 #undef __rrlib__localization__pose__include_guard__
 
@@ -90,6 +97,17 @@ using tPoseChange3D = tPose < 3, TElement, si_units::tSIUnit < 1, 0, -1, 0, 0, 0
 template <typename TElement = double, typename TAutoWrapPolicy = math::angle::NoWrap>
 using tTwist3D = tPoseChange3D<TElement, TAutoWrapPolicy>;
 
+//! Structure of arrays of standard poses for the two dimensional case.
+/*! For further documentation, see \ref tPoseArray< 2, TElement, TAutoWrapPolicy >
+ */
+template <typename TElement = double, typename TAutoWrapPolicy = math::angle::Signed>
+using tPoseArray2D = tPoseArray<2, TElement, TAutoWrapPolicy>;
+//! Structure of arrays of standard poses for the three dimensional case.
+/*! For further documentation, see \ref tPoseArray< 3, TElement, TAutoWrapPolicy >
+ */
+template <typename TElement = double, typename TAutoWrapPolicy = math::angle::Signed>
+using tPoseArray3D = tPoseArray<3, TElement, TAutoWrapPolicy>;
+
 //----------------------------------------------------------------------
 // Arithmetic operators
 //----------------------------------------------------------------------
@@ -142,6 +160,17 @@ extern template class tPose<3, float, si_units::tMeter, si_units::tNoUnit, math:
 extern template class tPose < 3, double, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 extern template class tPose < 3, float, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 
+extern template class tQuaternionPose<double, math::angle::Signed>;
+extern template class tQuaternionPose<float, math::angle::Signed>;
+
+extern template class tPoseWithCache<double, math::angle::Signed>;
+extern template class tPoseWithCache<float, math::angle::Signed>;
+
+extern template class tPoseArray<2, double, math::angle::Signed>;
+extern template class tPoseArray<2, float, math::angle::Signed>;
+extern template class tPoseArray<3, double, math::angle::Signed>;
+extern template class tPoseArray<3, float, math::angle::Signed>;
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -0,0 +1,141 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tSharedPose.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains \ref rrlib::localization::tSharedPose
+ *
+ * \b tSharedPose
+ *
+ * Publishes a pose from one writer thread to any number of reader
+ * threads without locks (a sequence lock). The writer never waits for
+ * readers. A reader repeats its copy if the writer changed the pose
+ * meanwhile, so it only spins while a write is in progress.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__tSharedPose_h__
+#define __rrlib__localization__tSharedPose_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <atomic>
+#include <cstddef>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tUncertainPose.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! A pose that is written by one thread and read by many threads
+/*! The components are kept in atomic raw values, so copying a pose in
+ *  and out is well defined even while the writer is active.
+ *
+ *  \tparam TPose A \ref tPose or \ref tUncertainPose, whose covariance is shared as well
+ */
+template <typename TPose = tUncertainPose3D<>>
+class tSharedPose
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TPose tValue;
+
+  explicit tSharedPose(const TPose &pose = TPose());
+
+  tSharedPose(const tSharedPose &other);
+
+  tSharedPose &operator = (const tSharedPose &other);
+
+  //! Publish a new pose
+  /*! Must only be called by one thread at a time.
+   */
+  void Store(const TPose &pose);
+
+  //! Get a consistent copy of the latest published pose
+  /*! May be called by any number of threads concurrently to Store.
+   */
+  TPose Load() const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  typedef typename TPose::tElement tElement;
+
+  static const size_t cPOSE_SIZE = pose::GetNumberOfPoseValues(static_cast<const TPose *>(nullptr));
+  static const size_t cCOVARIANCE_SIZE = pose::GetNumberOfCovarianceValues(static_cast<const TPose *>(nullptr));
+
+  //! Odd while a write is in progress
+  std::atomic<unsigned int> sequence;
+  std::atomic<tElement> values[cPOSE_SIZE + cCOVARIANCE_SIZE];
+
+  template <typename TOtherPose>
+  static void WriteCovariance(const TOtherPose &, tElement *)
+  {}
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  static void WriteCovariance(const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, tElement *values);
+
+  template <typename TOtherPose>
+  static void ReadCovariance(TOtherPose &, const tElement *)
+  {}
+  template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+  static void ReadCovariance(tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, const tElement *values);
+
+};
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/tSharedPose.hpp"
+
+#endif
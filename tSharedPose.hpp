@@ -0,0 +1,194 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tSharedPose.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+template <typename TPose>
+const size_t tSharedPose<TPose>::cPOSE_SIZE;
+template <typename TPose>
+const size_t tSharedPose<TPose>::cCOVARIANCE_SIZE;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tSharedPose constructors
+//----------------------------------------------------------------------
+template <typename TPose>
+tSharedPose<TPose>::tSharedPose(const TPose &pose) :
+  sequence(0)
+{
+  this->Store(pose);
+}
+
+template <typename TPose>
+tSharedPose<TPose>::tSharedPose(const tSharedPose &other) :
+  sequence(0)
+{
+  this->Store(other.Load());
+}
+
+//----------------------------------------------------------------------
+// tSharedPose operator =
+//----------------------------------------------------------------------
+template <typename TPose>
+tSharedPose<TPose> &tSharedPose<TPose>::operator = (const tSharedPose &other)
+{
+  this->Store(other.Load());
+  return *this;
+}
+
+//----------------------------------------------------------------------
+// tSharedPose Store
+//----------------------------------------------------------------------
+template <typename TPose>
+void tSharedPose<TPose>::Store(const TPose &pose)
+{
+  const size_t position_size = cPOSE_SIZE == 3 ? 2 : 3;
+  tElement raw[cPOSE_SIZE + cCOVARIANCE_SIZE];
+  for (size_t i = 0; i < position_size; ++i)
+  {
+    raw[i] = pose.Position()[i].Value();
+  }
+  for (size_t i = 0; i < cPOSE_SIZE - position_size; ++i)
+  {
+    raw[position_size + i] = pose.Orientation()[i].Value().Value();
+  }
+  WriteCovariance(pose, raw + cPOSE_SIZE);
+
+  const unsigned int sequence = this->sequence.load(std::memory_order_relaxed);
+  this->sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  for (size_t i = 0; i < cPOSE_SIZE + cCOVARIANCE_SIZE; ++i)
+  {
+    this->values[i].store(raw[i], std::memory_order_relaxed);
+  }
+  this->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------
+// tSharedPose Load
+//----------------------------------------------------------------------
+template <typename TPose>
+TPose tSharedPose<TPose>::Load() const
+{
+  tElement raw[cPOSE_SIZE + cCOVARIANCE_SIZE];
+  unsigned int sequence;
+  do
+  {
+    sequence = this->sequence.load(std::memory_order_acquire);
+    for (size_t i = 0; i < cPOSE_SIZE + cCOVARIANCE_SIZE; ++i)
+    {
+      raw[i] = this->values[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  while ((sequence & 1) || sequence != this->sequence.load(std::memory_order_relaxed));
+
+  const size_t position_size = cPOSE_SIZE == 3 ? 2 : 3;
+  TPose pose;
+  for (size_t i = 0; i < position_size; ++i)
+  {
+    pose.Position()[i] = typename TPose::template tPositionComponent<>(raw[i]);
+  }
+  for (size_t i = 0; i < cPOSE_SIZE - position_size; ++i)
+  {
+    pose.Orientation()[i] = typename TPose::template tOrientationComponent<>(raw[position_size + i]);
+  }
+  ReadCovariance(pose, raw + cPOSE_SIZE);
+  return pose;
+}
+
+//----------------------------------------------------------------------
+// tSharedPose WriteCovariance
+//----------------------------------------------------------------------
+template <typename TPose>
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tSharedPose<TPose>::WriteCovariance(const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, tElement *values)
+{
+  const size_t size = cPOSE_SIZE;
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (size_t j = 0; j < size; ++j)
+    {
+      values[i * size + j] = pose.Covariance()[i][j];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tSharedPose ReadCovariance
+//----------------------------------------------------------------------
+template <typename TPose>
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+void tSharedPose<TPose>::ReadCovariance(tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose, const tElement *values)
+{
+  const size_t size = cPOSE_SIZE;
+  for (size_t i = 0; i < size; ++i)
+  {
+    for (size_t j = 0; j < size; ++j)
+    {
+      pose.Covariance()[i][j] = values[i * size + j];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
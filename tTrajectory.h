@@ -0,0 +1,194 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectory.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains \ref rrlib::localization::tTrajectory
+ *
+ * \b tTrajectory
+ *
+ * A fixed capacity history of timestamped poses. Samples are appended
+ * in temporal order. When the buffer is full, the oldest sample is
+ * overwritten. Lookups by time use binary search and poses between two
+ * samples are interpolated. Memory is only allocated on construction,
+ * so the buffer can be used within real-time loops.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__tTrajectory_h__
+#define __rrlib__localization__tTrajectory_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/time/time.h"
+
+#include <cstddef>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tPose.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Ring buffer of timestamped poses with lookup by time
+/*! \tparam TPose A pose type that is supported by \ref Interpolate, e.g. tPose2D<> or tPose3D<>
+ */
+template <typename TPose = tPose3D<>>
+class tTrajectory
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TPose tValue;
+
+  //! A pose together with the time it refers to
+  struct tStampedPose
+  {
+    time::tTimestamp timestamp;
+    TPose pose;
+  };
+
+  //! Create an empty trajectory
+  /*! \param capacity The maximum number of samples kept in the buffer
+   */
+  explicit tTrajectory(size_t capacity);
+
+  inline size_t Capacity() const
+  {
+    return this->samples.size();
+  }
+
+  inline size_t Size() const
+  {
+    return this->size;
+  }
+
+  inline bool Empty() const
+  {
+    return this->size == 0;
+  }
+
+  void Clear();
+
+  //! Append a new sample
+  /*! If the buffer is full, the oldest sample is dropped.
+   *  \param timestamp The time of the sample, which must not be older than the newest sample
+   *  \param pose      The pose at timestamp
+   *  \returns Whether the sample was appended, i.e. false if it was older than the newest sample
+   */
+  bool Append(const time::tTimestamp &timestamp, const TPose &pose);
+
+  //! Access samples in temporal order, i.e. index 0 is the oldest one
+  inline const tStampedPose &operator[](size_t index) const
+  {
+    assert(index < this->size);
+    return this->samples[(this->first + index) % this->samples.size()];
+  }
+
+  inline const tStampedPose &Oldest() const
+  {
+    return (*this)[0];
+  }
+
+  inline const tStampedPose &Newest() const
+  {
+    return (*this)[this->size - 1];
+  }
+
+  //! Get the index of the first sample that is not older than timestamp
+  /*! \returns The index in [0, Size()], where Size() means that all samples are older
+   */
+  size_t LowerBound(const time::tTimestamp &timestamp) const;
+
+  //! Get the pose at the given time
+  /*! Between two samples the pose is interpolated, but no extrapolation
+   *  is done beyond the oldest or newest sample.
+   *  \param timestamp The time to get the pose for
+   *  \param pose      Is set to the resulting pose
+   *  \param method    The interpolation method
+   *  \returns Whether timestamp is covered by the trajectory
+   */
+  bool GetPose(const time::tTimestamp &timestamp, TPose &pose, tInterpolationMethod method = eIM_SLERP) const;
+
+  //! Copy all samples within [begin, end]
+  /*! \param begin     The start of the time range
+   *  \param end       The end of the time range
+   *  \param result    Storage for up to max_count samples
+   *  \param max_count The maximum number of samples to copy
+   *  \returns The number of copied samples
+   */
+  size_t GetRange(const time::tTimestamp &begin, const time::tTimestamp &end, tStampedPose *result, size_t max_count) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  std::vector<tStampedPose> samples;
+  size_t first;
+  size_t size;
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tTrajectory<tPose2D<>>;
+extern template class tTrajectory<tPose3D<>>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/tTrajectory.hpp"
+
+#endif
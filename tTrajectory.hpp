@@ -0,0 +1,173 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectory.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <chrono>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tTrajectory constructors
+//----------------------------------------------------------------------
+template <typename TPose>
+tTrajectory<TPose>::tTrajectory(size_t capacity) :
+  samples(capacity),
+  first(0),
+  size(0)
+{
+  assert(capacity > 0);
+}
+
+//----------------------------------------------------------------------
+// tTrajectory Clear
+//----------------------------------------------------------------------
+template <typename TPose>
+void tTrajectory<TPose>::Clear()
+{
+  this->first = 0;
+  this->size = 0;
+}
+
+//----------------------------------------------------------------------
+// tTrajectory Append
+//----------------------------------------------------------------------
+template <typename TPose>
+bool tTrajectory<TPose>::Append(const time::tTimestamp &timestamp, const TPose &pose)
+{
+  if (this->size > 0 && timestamp < this->Newest().timestamp)
+  {
+    return false;
+  }
+  if (this->size == this->samples.size())
+  {
+    this->first = (this->first + 1) % this->samples.size();
+    this->size--;
+  }
+  tStampedPose &sample = this->samples[(this->first + this->size) % this->samples.size()];
+  sample.timestamp = timestamp;
+  sample.pose = pose;
+  this->size++;
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTrajectory LowerBound
+//----------------------------------------------------------------------
+template <typename TPose>
+size_t tTrajectory<TPose>::LowerBound(const time::tTimestamp &timestamp) const
+{
+  size_t begin = 0;
+  size_t end = this->size;
+  while (begin < end)
+  {
+    const size_t middle = begin + (end - begin) / 2;
+    if ((*this)[middle].timestamp < timestamp)
+    {
+      begin = middle + 1;
+    }
+    else
+    {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+//----------------------------------------------------------------------
+// tTrajectory GetPose
+//----------------------------------------------------------------------
+template <typename TPose>
+bool tTrajectory<TPose>::GetPose(const time::tTimestamp &timestamp, TPose &pose, tInterpolationMethod method) const
+{
+  if (this->size == 0 || timestamp < this->Oldest().timestamp || this->Newest().timestamp < timestamp)
+  {
+    return false;
+  }
+  const size_t index = this->LowerBound(timestamp);
+  const tStampedPose &next = (*this)[index];
+  if (index == 0 || next.timestamp == timestamp)
+  {
+    pose = next.pose;
+    return true;
+  }
+  const tStampedPose &previous = (*this)[index - 1];
+  const double factor = std::chrono::duration<double>(timestamp - previous.timestamp).count() / std::chrono::duration<double>(next.timestamp - previous.timestamp).count();
+  pose = Interpolate(previous.pose, next.pose, factor, method);
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTrajectory GetRange
+//----------------------------------------------------------------------
+template <typename TPose>
+size_t tTrajectory<TPose>::GetRange(const time::tTimestamp &begin, const time::tTimestamp &end, tStampedPose *result, size_t max_count) const
+{
+  size_t count = 0;
+  for (size_t i = this->LowerBound(begin); i < this->size && count < max_count && !(end < (*this)[i].timestamp); ++i, ++count)
+  {
+    result[count] = (*this)[i];
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,264 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectoryLog.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/localization/tTrajectoryLog.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+namespace trajectory_log
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+namespace
+{
+
+const char cHEADER_MAGIC[4] = {'R', 'R', 'T', 'L'};
+const char cINDEX_MAGIC[4] = {'R', 'R', 'T', 'I'};
+const uint8_t cVERSION = 1;
+const size_t cINDEX_ENTRY_SIZE = 16;
+const size_t cTRAILER_SIZE = 3 * 8 + sizeof(cINDEX_MAGIC);
+
+}
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+inline void WriteDouble(double value, std::vector<uint8_t> &buffer)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  WriteFixed64(bits, buffer);
+}
+
+inline double ReadDouble(const uint8_t *data)
+{
+  const uint64_t bits = ReadFixed64(data);
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+inline uint32_t ReadFixed32(const uint8_t *data)
+{
+  return static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 | static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24;
+}
+
+}
+
+//----------------------------------------------------------------------
+// WriteHeader
+//----------------------------------------------------------------------
+void WriteHeader(const tHeader &header, std::vector<uint8_t> &buffer)
+{
+  assert(header.keyframe_interval <= 0xFFFFFFFF);
+  buffer.insert(buffer.end(), cHEADER_MAGIC, cHEADER_MAGIC + sizeof(cHEADER_MAGIC));
+  buffer.push_back(cVERSION);
+  buffer.push_back(static_cast<uint8_t>(header.number_of_components));
+  buffer.push_back(0);
+  buffer.push_back(0);
+  for (size_t i = 0; i < 4; ++i)
+  {
+    buffer.push_back(static_cast<uint8_t>(header.keyframe_interval >> (8 * i)));
+  }
+  buffer.insert(buffer.end(), 4, 0);
+  WriteDouble(header.position_resolution, buffer);
+  WriteDouble(header.orientation_resolution, buffer);
+}
+
+//----------------------------------------------------------------------
+// ReadHeader
+//----------------------------------------------------------------------
+bool ReadHeader(const uint8_t *data, size_t size, tHeader &header)
+{
+  if (size < cHEADER_SIZE || std::memcmp(data, cHEADER_MAGIC, sizeof(cHEADER_MAGIC)) != 0 || data[4] != cVERSION)
+  {
+    return false;
+  }
+  header.number_of_components = data[5];
+  header.keyframe_interval = ReadFixed32(data + 8);
+  header.position_resolution = ReadDouble(data + 16);
+  header.orientation_resolution = ReadDouble(data + 24);
+  return header.keyframe_interval > 0 && header.position_resolution > 0 && header.orientation_resolution > 0;
+}
+
+//----------------------------------------------------------------------
+// WriteIndex
+//----------------------------------------------------------------------
+void WriteIndex(const std::vector<tIndexEntry> &index, uint64_t number_of_records, uint64_t index_offset, std::vector<uint8_t> &buffer)
+{
+  for (auto & entry : index)
+  {
+    WriteFixed64(static_cast<uint64_t>(entry.timestamp), buffer);
+    WriteFixed64(entry.offset, buffer);
+  }
+  WriteFixed64(index.size(), buffer);
+  WriteFixed64(number_of_records, buffer);
+  WriteFixed64(index_offset, buffer);
+  buffer.insert(buffer.end(), cINDEX_MAGIC, cINDEX_MAGIC + sizeof(cINDEX_MAGIC));
+}
+
+//----------------------------------------------------------------------
+// ReadIndex
+//----------------------------------------------------------------------
+bool ReadIndex(const uint8_t *data, size_t size, std::vector<tIndexEntry> &index, uint64_t &number_of_records, uint64_t &index_offset)
+{
+  if (size < cHEADER_SIZE + cTRAILER_SIZE)
+  {
+    return false;
+  }
+  const uint8_t *trailer = data + size - cTRAILER_SIZE;
+  if (std::memcmp(trailer + 3 * 8, cINDEX_MAGIC, sizeof(cINDEX_MAGIC)) != 0)
+  {
+    return false;
+  }
+  const uint64_t number_of_blocks = ReadFixed64(trailer);
+  number_of_records = ReadFixed64(trailer + 8);
+  index_offset = ReadFixed64(trailer + 16);
+  const size_t end_of_index = size - cTRAILER_SIZE;
+  if (index_offset < cHEADER_SIZE || index_offset > end_of_index || (end_of_index - index_offset) / cINDEX_ENTRY_SIZE != number_of_blocks || (end_of_index - index_offset) % cINDEX_ENTRY_SIZE != 0)
+  {
+    return false;
+  }
+
+  index.resize(number_of_blocks);
+  const uint8_t *entry = data + index_offset;
+  for (size_t i = 0; i < number_of_blocks; ++i, entry += cINDEX_ENTRY_SIZE)
+  {
+    index[i].timestamp = static_cast<int64_t>(ReadFixed64(entry));
+    index[i].offset = ReadFixed64(entry + 8);
+    if (index[i].offset < cHEADER_SIZE || index[i].offset >= index_offset || (i > 0 && (index[i].offset <= index[i - 1].offset || index[i].timestamp < index[i - 1].timestamp)))
+    {
+      index.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tMappedFile constructors
+//----------------------------------------------------------------------
+tMappedFile::tMappedFile(const std::string &file_name) :
+  descriptor(open(file_name.c_str(), O_RDONLY)),
+  data(nullptr),
+  size(0)
+{
+  if (this->descriptor < 0)
+  {
+    throw std::runtime_error("Could not open '" + file_name + "'");
+  }
+  struct stat status;
+  if (fstat(this->descriptor, &status) != 0)
+  {
+    close(this->descriptor);
+    throw std::runtime_error("Could not get the size of '" + file_name + "'");
+  }
+  this->size = static_cast<size_t>(status.st_size);
+  if (this->size > 0)
+  {
+    void *mapping = mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, this->descriptor, 0);
+    if (mapping == MAP_FAILED)
+    {
+      close(this->descriptor);
+      throw std::runtime_error("Could not map '" + file_name + "'");
+    }
+    this->data = static_cast<const uint8_t *>(mapping);
+  }
+}
+
+//----------------------------------------------------------------------
+// tMappedFile destructor
+//----------------------------------------------------------------------
+tMappedFile::~tMappedFile()
+{
+  if (this->data)
+  {
+    munmap(const_cast<uint8_t *>(this->data), this->size);
+  }
+  close(this->descriptor);
+}
+
+//----------------------------------------------------------------------
+// End of namespace trajectory_log
+//----------------------------------------------------------------------
+}
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+template class tTrajectoryLogWriter<tPose2D<>>;
+template class tTrajectoryLogWriter<tPose3D<>>;
+template class tTrajectoryLogReader<tPose2D<>>;
+template class tTrajectoryLogReader<tPose3D<>>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,432 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectoryLog.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains \ref rrlib::localization::tTrajectoryLogWriter and \ref rrlib::localization::tTrajectoryLogReader
+ *
+ * \b tTrajectoryLogWriter
+ *
+ * Streams timestamped poses to a file in a compact format for long
+ * recordings. The components are quantised with fixed resolutions and
+ * grouped into blocks. Each block starts with a keyframe that holds the
+ * absolute values, and each following record stores the differences to
+ * its predecessor as variable-length integers. With typical sample rates
+ * a record takes a few bytes only.
+ *
+ * \b tTrajectoryLogReader
+ *
+ * Maps a log into memory and provides lookups by time like \ref tTrajectory.
+ * A sparse index with the first timestamp and the offset of each block is
+ * appended by the writer on close, so a lookup only has to decode a single
+ * block. If the index is missing, e.g. because the writer was not closed
+ * properly, it is rebuilt by scanning the file.
+ *
+ * File layout (all values little endian):
+ *   - Header: "RRTL", version, number of components, keyframe interval,
+ *     position and orientation resolution
+ *   - Keyframe: timestamp in ns (8 bytes), zigzag varint components
+ *   - Record: varint time delta in ns, zigzag varint component deltas
+ *   - Index: (first timestamp, offset) per block, number of blocks,
+ *     number of records, offset of the index, "RRTI"
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__tTrajectoryLog_h__
+#define __rrlib__localization__tTrajectoryLog_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/time/time.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tPose.h"
+#include "rrlib/localization/tTrajectory.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+namespace trajectory_log
+{
+
+//! The settings stored at the beginning of each log
+struct tHeader
+{
+  size_t number_of_components;
+  size_t keyframe_interval;
+  double position_resolution;
+  double orientation_resolution;
+};
+
+//! The sparse index entry for one block
+struct tIndexEntry
+{
+  int64_t timestamp;
+  uint64_t offset;
+};
+
+const size_t cHEADER_SIZE = 32;
+const size_t cKEYFRAME_TIMESTAMP_SIZE = 8;
+
+void WriteHeader(const tHeader &header, std::vector<uint8_t> &buffer);
+
+//! Read and check the header
+/*! \returns Whether data starts with a valid header
+ */
+bool ReadHeader(const uint8_t *data, size_t size, tHeader &header);
+
+void WriteIndex(const std::vector<tIndexEntry> &index, uint64_t number_of_records, uint64_t index_offset, std::vector<uint8_t> &buffer);
+
+//! Read the index from the end of a log
+/*! \returns Whether a complete index was found
+ */
+bool ReadIndex(const uint8_t *data, size_t size, std::vector<tIndexEntry> &index, uint64_t &number_of_records, uint64_t &index_offset);
+
+inline void WriteFixed64(uint64_t value, std::vector<uint8_t> &buffer)
+{
+  for (size_t i = 0; i < 8; ++i)
+  {
+    buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+inline uint64_t ReadFixed64(const uint8_t *data)
+{
+  uint64_t value = 0;
+  for (size_t i = 0; i < 8; ++i)
+  {
+    value |= static_cast<uint64_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+inline void WriteVarint(uint64_t value, std::vector<uint8_t> &buffer)
+{
+  while (value >= 0x80)
+  {
+    buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+    value >>= 7;
+  }
+  buffer.push_back(static_cast<uint8_t>(value));
+}
+
+//! Read a varint and advance data
+/*! \returns False if the varint does not end before end
+ */
+inline bool ReadVarint(const uint8_t *&data, const uint8_t *end, uint64_t &value)
+{
+  value = 0;
+  for (unsigned int shift = 0; data < end && shift < 64; shift += 7)
+  {
+    const uint8_t byte = *data++;
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+//! Map signed to unsigned values so that small magnitudes get short varints
+inline uint64_t EncodeZigZag(int64_t value)
+{
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t DecodeZigZag(uint64_t value)
+{
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+inline int64_t ToNanoseconds(const time::tTimestamp &timestamp)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(timestamp.time_since_epoch()).count();
+}
+
+inline time::tTimestamp FromNanoseconds(int64_t nanoseconds)
+{
+  return time::tTimestamp(std::chrono::duration_cast<time::tTimestamp::duration>(std::chrono::nanoseconds(nanoseconds)));
+}
+
+//! A read-only memory mapping of a whole file
+class tMappedFile
+{
+public:
+
+  //! Map the given file
+  /*! \exception std::runtime_error if the file cannot be opened or mapped
+   */
+  explicit tMappedFile(const std::string &file_name);
+
+  ~tMappedFile();
+
+  tMappedFile(const tMappedFile &) = delete;
+  tMappedFile &operator = (const tMappedFile &) = delete;
+
+  inline const uint8_t *Data() const
+  {
+    return this->data;
+  }
+
+  inline size_t Size() const
+  {
+    return this->size;
+  }
+
+private:
+
+  int descriptor;
+  const uint8_t *data;
+  size_t size;
+
+};
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Writes a stream of timestamped poses to a delta compressed log
+/*! \tparam TPose A pose type with raw access like tPose2D<> or tPose3D<>
+ */
+template <typename TPose = tPose3D<>>
+class tTrajectoryLogWriter
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TPose tValue;
+
+  static const size_t cNUMBER_OF_COMPONENTS = pose::GetNumberOfPoseValues(static_cast<const TPose *>(nullptr));
+
+  //! Create a new log file
+  /*! \param file_name              The file to create, which is truncated if it exists
+   *  \param position_resolution    The quantisation step of the position components
+   *  \param orientation_resolution The quantisation step of the orientation components in radian
+   *  \param keyframe_interval      The number of records per block, i.e. the granularity of random access
+   *  \exception std::runtime_error if the file cannot be created
+   */
+  explicit tTrajectoryLogWriter(const std::string &file_name, double position_resolution = 1E-3, double orientation_resolution = 0.01 * math::cPI / 180, size_t keyframe_interval = 1000);
+
+  //! Closes the log if Close was not called before
+  ~tTrajectoryLogWriter();
+
+  tTrajectoryLogWriter(const tTrajectoryLogWriter &) = delete;
+  tTrajectoryLogWriter &operator = (const tTrajectoryLogWriter &) = delete;
+
+  inline size_t Size() const
+  {
+    return this->number_of_records;
+  }
+
+  //! Append a new sample
+  /*! \param timestamp The time of the sample, which must not be older than the previous sample
+   *  \param pose      The pose at timestamp
+   *  \returns Whether the sample was appended, i.e. false if it was older than the previous sample
+   *  \exception std::runtime_error if writing to the file fails
+   */
+  bool Append(const time::tTimestamp &timestamp, const TPose &pose);
+
+  //! Write all buffered records to the file
+  void Flush();
+
+  //! Flush the records, append the index and close the file
+  void Close();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  static const size_t cFLUSH_SIZE = 1 << 16;
+
+  std::FILE *file;
+  trajectory_log::tHeader header;
+  std::vector<uint8_t> buffer;
+  std::vector<trajectory_log::tIndexEntry> index;
+  uint64_t offset;
+  uint64_t number_of_records;
+  int64_t last_timestamp;
+  int64_t last_values[cNUMBER_OF_COMPONENTS];
+
+};
+
+//! Random access to a log created by \ref tTrajectoryLogWriter via a memory mapping
+/*! \tparam TPose The pose type the log was written with
+ */
+template <typename TPose = tPose3D<>>
+class tTrajectoryLogReader
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TPose tValue;
+  typedef typename tTrajectory<TPose>::tStampedPose tStampedPose;
+
+  static const size_t cNUMBER_OF_COMPONENTS = pose::GetNumberOfPoseValues(static_cast<const TPose *>(nullptr));
+
+  //! Open a log
+  /*! \exception std::runtime_error if the file cannot be mapped or is no log of TPose
+   */
+  explicit tTrajectoryLogReader(const std::string &file_name);
+
+  inline size_t Size() const
+  {
+    return this->number_of_records;
+  }
+
+  inline bool Empty() const
+  {
+    return this->number_of_records == 0;
+  }
+
+  //! Whether the index was missing and had to be rebuilt
+  inline bool IndexRecovered() const
+  {
+    return this->index_recovered;
+  }
+
+  //! The timestamp of the first record, which must only be called if the log is not empty
+  inline time::tTimestamp OldestTimestamp() const
+  {
+    return trajectory_log::FromNanoseconds(this->index.front().timestamp);
+  }
+
+  //! The timestamp of the last record, which must only be called if the log is not empty
+  inline time::tTimestamp NewestTimestamp() const
+  {
+    return trajectory_log::FromNanoseconds(this->newest_timestamp);
+  }
+
+  //! Get the pose at the given time
+  /*! Between two records the pose is interpolated, but no extrapolation
+   *  is done beyond the oldest or newest record.
+   *  \param timestamp The time to get the pose for
+   *  \param pose      Is set to the resulting pose
+   *  \param method    The interpolation method
+   *  \returns Whether timestamp is covered by the log
+   */
+  bool GetPose(const time::tTimestamp &timestamp, TPose &pose, tInterpolationMethod method = eIM_SLERP) const;
+
+  //! Copy all records within [begin, end]
+  /*! \param begin     The start of the time range
+   *  \param end       The end of the time range
+   *  \param result    Storage for up to max_count records
+   *  \param max_count The maximum number of records to copy
+   *  \returns The number of copied records
+   */
+  size_t GetRange(const time::tTimestamp &begin, const time::tTimestamp &end, tStampedPose *result, size_t max_count) const;
+
+  //! Decode all records in temporal order, e.g. to replay a log
+  /*! \param function Is called with (const time::tTimestamp &, const TPose &) for each record
+   */
+  template <typename TFunction>
+  void ForEach(TFunction function) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  //! The decoder state, i.e. the quantised values of the last decoded record
+  struct tCursor
+  {
+    const uint8_t *data;
+    size_t record;
+    int64_t timestamp;
+    int64_t values[cNUMBER_OF_COMPONENTS];
+  };
+
+  trajectory_log::tMappedFile file;
+  trajectory_log::tHeader header;
+  std::vector<trajectory_log::tIndexEntry> index;
+  const uint8_t *end_of_records;
+  size_t number_of_records;
+  int64_t newest_timestamp;
+  bool index_recovered;
+
+  void RebuildIndex();
+
+  void Seek(size_t block, tCursor &cursor) const;
+
+  //! Decode the record at cursor and advance it
+  /*! \returns False if there are no more complete records
+   */
+  bool Next(tCursor &cursor) const;
+
+  TPose GetPose(const tCursor &cursor) const;
+
+  //! Get the last block that starts before timestamp, or 0 if there is none
+  size_t FindBlock(int64_t timestamp) const;
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tTrajectoryLogWriter<tPose2D<>>;
+extern template class tTrajectoryLogWriter<tPose3D<>>;
+extern template class tTrajectoryLogReader<tPose2D<>>;
+extern template class tTrajectoryLogReader<tPose3D<>>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/tTrajectoryLog.hpp"
+
+#endif
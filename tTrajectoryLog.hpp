@@ -0,0 +1,443 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectoryLog.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+template <typename TPose>
+const size_t tTrajectoryLogWriter<TPose>::cNUMBER_OF_COMPONENTS;
+template <typename TPose>
+const size_t tTrajectoryLogWriter<TPose>::cFLUSH_SIZE;
+template <typename TPose>
+const size_t tTrajectoryLogReader<TPose>::cNUMBER_OF_COMPONENTS;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tTrajectoryLogWriter constructors
+//----------------------------------------------------------------------
+template <typename TPose>
+tTrajectoryLogWriter<TPose>::tTrajectoryLogWriter(const std::string &file_name, double position_resolution, double orientation_resolution, size_t keyframe_interval) :
+  file(std::fopen(file_name.c_str(), "wb")),
+  header {cNUMBER_OF_COMPONENTS, keyframe_interval, position_resolution, orientation_resolution},
+  offset(0),
+  number_of_records(0),
+  last_timestamp(0),
+  last_values {}
+{
+  assert(position_resolution > 0 && orientation_resolution > 0);
+  assert(keyframe_interval > 0);
+  if (!this->file)
+  {
+    throw std::runtime_error("Could not create trajectory log '" + file_name + "'");
+  }
+  this->buffer.reserve(cFLUSH_SIZE + 128);
+  trajectory_log::WriteHeader(this->header, this->buffer);
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogWriter destructor
+//----------------------------------------------------------------------
+template <typename TPose>
+tTrajectoryLogWriter<TPose>::~tTrajectoryLogWriter()
+{
+  if (this->file)
+  {
+    try
+    {
+      this->Close();
+    }
+    catch (const std::runtime_error &)
+    {}
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogWriter Append
+//----------------------------------------------------------------------
+template <typename TPose>
+bool tTrajectoryLogWriter<TPose>::Append(const time::tTimestamp &timestamp, const TPose &pose)
+{
+  assert(this->file);
+  const int64_t nanoseconds = trajectory_log::ToNanoseconds(timestamp);
+  if (this->number_of_records > 0 && nanoseconds < this->last_timestamp)
+  {
+    return false;
+  }
+
+  const size_t position_size = cNUMBER_OF_COMPONENTS == 3 ? 2 : 3;
+  int64_t values[cNUMBER_OF_COMPONENTS];
+  for (size_t i = 0; i < position_size; ++i)
+  {
+    values[i] = std::llround(pose.Position()[i].Value() / this->header.position_resolution);
+  }
+  for (size_t i = 0; i < cNUMBER_OF_COMPONENTS - position_size; ++i)
+  {
+    values[position_size + i] = std::llround(pose.Orientation()[i].Value().Value() / this->header.orientation_resolution);
+  }
+
+  if (this->number_of_records % this->header.keyframe_interval == 0)
+  {
+    this->index.push_back(trajectory_log::tIndexEntry {nanoseconds, this->offset + this->buffer.size()});
+    trajectory_log::WriteFixed64(static_cast<uint64_t>(nanoseconds), this->buffer);
+    for (size_t i = 0; i < cNUMBER_OF_COMPONENTS; ++i)
+    {
+      trajectory_log::WriteVarint(trajectory_log::EncodeZigZag(values[i]), this->buffer);
+    }
+  }
+  else
+  {
+    trajectory_log::WriteVarint(static_cast<uint64_t>(nanoseconds - this->last_timestamp), this->buffer);
+    for (size_t i = 0; i < cNUMBER_OF_COMPONENTS; ++i)
+    {
+      trajectory_log::WriteVarint(trajectory_log::EncodeZigZag(values[i] - this->last_values[i]), this->buffer);
+    }
+  }
+
+  this->last_timestamp = nanoseconds;
+  std::copy(values, values + cNUMBER_OF_COMPONENTS, this->last_values);
+  this->number_of_records++;
+  if (this->buffer.size() >= cFLUSH_SIZE)
+  {
+    this->Flush();
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogWriter Flush
+//----------------------------------------------------------------------
+template <typename TPose>
+void tTrajectoryLogWriter<TPose>::Flush()
+{
+  assert(this->file);
+  if (!this->buffer.empty() && std::fwrite(this->buffer.data(), 1, this->buffer.size(), this->file) != this->buffer.size())
+  {
+    throw std::runtime_error("Could not write trajectory log");
+  }
+  this->offset += this->buffer.size();
+  this->buffer.clear();
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogWriter Close
+//----------------------------------------------------------------------
+template <typename TPose>
+void tTrajectoryLogWriter<TPose>::Close()
+{
+  assert(this->file);
+  trajectory_log::WriteIndex(this->index, this->number_of_records, this->offset + this->buffer.size(), this->buffer);
+  std::FILE *handle = this->file;
+  this->file = nullptr;
+  bool success = this->buffer.empty() || std::fwrite(this->buffer.data(), 1, this->buffer.size(), handle) == this->buffer.size();
+  this->offset += this->buffer.size();
+  this->buffer.clear();
+  success = std::fclose(handle) == 0 && success;
+  if (!success)
+  {
+    throw std::runtime_error("Could not write trajectory log");
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader constructors
+//----------------------------------------------------------------------
+template <typename TPose>
+tTrajectoryLogReader<TPose>::tTrajectoryLogReader(const std::string &file_name) :
+  file(file_name),
+  end_of_records(nullptr),
+  number_of_records(0),
+  newest_timestamp(0),
+  index_recovered(false)
+{
+  if (!trajectory_log::ReadHeader(this->file.Data(), this->file.Size(), this->header))
+  {
+    throw std::runtime_error("'" + file_name + "' is no trajectory log");
+  }
+  if (this->header.number_of_components != cNUMBER_OF_COMPONENTS)
+  {
+    throw std::runtime_error("'" + file_name + "' contains poses of another dimension");
+  }
+
+  uint64_t number_of_records = 0;
+  uint64_t index_offset = 0;
+  if (trajectory_log::ReadIndex(this->file.Data(), this->file.Size(), this->index, number_of_records, index_offset) &&
+      index_offset >= trajectory_log::cHEADER_SIZE && this->index.size() == (number_of_records + this->header.keyframe_interval - 1) / this->header.keyframe_interval)
+  {
+    this->end_of_records = this->file.Data() + index_offset;
+    this->number_of_records = number_of_records;
+  }
+  else
+  {
+    this->RebuildIndex();
+  }
+
+  if (!this->index.empty())
+  {
+    tCursor cursor;
+    this->Seek(this->index.size() - 1, cursor);
+    while (this->Next(cursor))
+    {
+      this->newest_timestamp = cursor.timestamp;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader GetPose
+//----------------------------------------------------------------------
+template <typename TPose>
+bool tTrajectoryLogReader<TPose>::GetPose(const time::tTimestamp &timestamp, TPose &pose, tInterpolationMethod method) const
+{
+  const int64_t nanoseconds = trajectory_log::ToNanoseconds(timestamp);
+  if (this->Empty() || nanoseconds < this->index.front().timestamp || this->newest_timestamp < nanoseconds)
+  {
+    return false;
+  }
+  tCursor cursor;
+  this->Seek(this->FindBlock(nanoseconds), cursor);
+  this->Next(cursor);
+  tCursor previous = cursor;
+  while (cursor.timestamp < nanoseconds)
+  {
+    previous = cursor;
+    if (!this->Next(cursor))
+    {
+      return false;
+    }
+  }
+  if (cursor.timestamp == nanoseconds)
+  {
+    pose = this->GetPose(cursor);
+    return true;
+  }
+  const double factor = static_cast<double>(nanoseconds - previous.timestamp) / static_cast<double>(cursor.timestamp - previous.timestamp);
+  pose = Interpolate(this->GetPose(previous), this->GetPose(cursor), factor, method);
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader GetRange
+//----------------------------------------------------------------------
+template <typename TPose>
+size_t tTrajectoryLogReader<TPose>::GetRange(const time::tTimestamp &begin, const time::tTimestamp &end, tStampedPose *result, size_t max_count) const
+{
+  const int64_t first = trajectory_log::ToNanoseconds(begin);
+  const int64_t last = trajectory_log::ToNanoseconds(end);
+  if (this->Empty() || last < first)
+  {
+    return 0;
+  }
+  size_t count = 0;
+  tCursor cursor;
+  this->Seek(this->FindBlock(first), cursor);
+  while (count < max_count && this->Next(cursor) && cursor.timestamp <= last)
+  {
+    if (first <= cursor.timestamp)
+    {
+      result[count].timestamp = trajectory_log::FromNanoseconds(cursor.timestamp);
+      result[count].pose = this->GetPose(cursor);
+      count++;
+    }
+  }
+  return count;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader ForEach
+//----------------------------------------------------------------------
+template <typename TPose>
+template <typename TFunction>
+void tTrajectoryLogReader<TPose>::ForEach(TFunction function) const
+{
+  tCursor cursor;
+  cursor.data = this->file.Data() + trajectory_log::cHEADER_SIZE;
+  cursor.record = 0;
+  while (this->Next(cursor))
+  {
+    function(trajectory_log::FromNanoseconds(cursor.timestamp), this->GetPose(cursor));
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader RebuildIndex
+//----------------------------------------------------------------------
+template <typename TPose>
+void tTrajectoryLogReader<TPose>::RebuildIndex()
+{
+  this->index.clear();
+  this->index_recovered = true;
+  this->end_of_records = this->file.Data() + this->file.Size();
+  this->number_of_records = std::numeric_limits<size_t>::max();
+
+  tCursor cursor;
+  cursor.data = this->file.Data() + trajectory_log::cHEADER_SIZE;
+  cursor.record = 0;
+  const uint8_t *start = cursor.data;
+  while (this->Next(cursor))
+  {
+    if ((cursor.record - 1) % this->header.keyframe_interval == 0)
+    {
+      this->index.push_back(trajectory_log::tIndexEntry {cursor.timestamp, static_cast<uint64_t>(start - this->file.Data())});
+    }
+    start = cursor.data;
+  }
+  this->end_of_records = start;
+  this->number_of_records = cursor.record;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader Seek
+//----------------------------------------------------------------------
+template <typename TPose>
+void tTrajectoryLogReader<TPose>::Seek(size_t block, tCursor &cursor) const
+{
+  assert(block < this->index.size());
+  cursor.data = this->file.Data() + this->index[block].offset;
+  cursor.record = block * this->header.keyframe_interval;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader Next
+//----------------------------------------------------------------------
+template <typename TPose>
+bool tTrajectoryLogReader<TPose>::Next(tCursor &cursor) const
+{
+  if (cursor.record >= this->number_of_records)
+  {
+    return false;
+  }
+  const uint8_t *data = cursor.data;
+  uint64_t value;
+  if (cursor.record % this->header.keyframe_interval == 0)
+  {
+    if (this->end_of_records - data < static_cast<std::ptrdiff_t>(trajectory_log::cKEYFRAME_TIMESTAMP_SIZE))
+    {
+      return false;
+    }
+    cursor.timestamp = static_cast<int64_t>(trajectory_log::ReadFixed64(data));
+    data += trajectory_log::cKEYFRAME_TIMESTAMP_SIZE;
+    for (size_t i = 0; i < cNUMBER_OF_COMPONENTS; ++i)
+    {
+      if (!trajectory_log::ReadVarint(data, this->end_of_records, value))
+      {
+        return false;
+      }
+      cursor.values[i] = trajectory_log::DecodeZigZag(value);
+    }
+  }
+  else
+  {
+    if (!trajectory_log::ReadVarint(data, this->end_of_records, value))
+    {
+      return false;
+    }
+    cursor.timestamp += static_cast<int64_t>(value);
+    for (size_t i = 0; i < cNUMBER_OF_COMPONENTS; ++i)
+    {
+      if (!trajectory_log::ReadVarint(data, this->end_of_records, value))
+      {
+        return false;
+      }
+      cursor.values[i] += trajectory_log::DecodeZigZag(value);
+    }
+  }
+  cursor.data = data;
+  cursor.record++;
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader GetPose
+//----------------------------------------------------------------------
+template <typename TPose>
+TPose tTrajectoryLogReader<TPose>::GetPose(const tCursor &cursor) const
+{
+  const size_t position_size = cNUMBER_OF_COMPONENTS == 3 ? 2 : 3;
+  TPose pose;
+  for (size_t i = 0; i < position_size; ++i)
+  {
+    pose.Position()[i] = typename TPose::template tPositionComponent<>(cursor.values[i] * this->header.position_resolution);
+  }
+  for (size_t i = 0; i < cNUMBER_OF_COMPONENTS - position_size; ++i)
+  {
+    pose.Orientation()[i] = typename TPose::template tOrientationComponent<>(cursor.values[position_size + i] * this->header.orientation_resolution);
+  }
+  return pose;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryLogReader FindBlock
+//----------------------------------------------------------------------
+template <typename TPose>
+size_t tTrajectoryLogReader<TPose>::FindBlock(int64_t timestamp) const
+{
+  const auto block = std::lower_bound(this->index.begin(), this->index.end(), timestamp, [](const trajectory_log::tIndexEntry & entry, int64_t timestamp)
+  {
+    return entry.timestamp < timestamp;
+  });
+  return block == this->index.begin() ? 0 : block - this->index.begin() - 1;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,152 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectoryStore.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/localization/tTrajectoryStore.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstring>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+namespace trajectory_store
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+namespace
+{
+
+const char cMAGIC[4] = {'R', 'R', 'T', 'S'};
+const uint8_t cVERSION = 2;
+//! Written in native byte order to detect files from other platforms
+const uint32_t cBYTE_ORDER_MARK = 0x01020304;
+
+}
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// WriteHeader
+//----------------------------------------------------------------------
+void WriteHeader(const tHeader &header, uint8_t(&buffer)[cHEADER_SIZE])
+{
+  std::memset(buffer, 0, cHEADER_SIZE);
+  std::memcpy(buffer, cMAGIC, sizeof(cMAGIC));
+  buffer[4] = cVERSION;
+  buffer[5] = static_cast<uint8_t>(header.dimension);
+  buffer[6] = static_cast<uint8_t>(header.element_size);
+  buffer[7] = header.floating_point_elements ? 1 : 0;
+  std::memcpy(buffer + 8, &cBYTE_ORDER_MARK, sizeof(cBYTE_ORDER_MARK));
+  const uint16_t number_of_pose_values = static_cast<uint16_t>(header.number_of_pose_values);
+  const uint16_t number_of_covariance_values = static_cast<uint16_t>(header.number_of_covariance_values);
+  const uint32_t record_size = static_cast<uint32_t>(header.record_size);
+  std::memcpy(buffer + 12, &number_of_pose_values, sizeof(number_of_pose_values));
+  std::memcpy(buffer + 14, &number_of_covariance_values, sizeof(number_of_covariance_values));
+  std::memcpy(buffer + 16, &record_size, sizeof(record_size));
+}
+
+//----------------------------------------------------------------------
+// ReadHeader
+//----------------------------------------------------------------------
+bool ReadHeader(const uint8_t *data, size_t size, tHeader &header)
+{
+  uint32_t byte_order_mark = 0;
+  if (size < cHEADER_SIZE || std::memcmp(data, cMAGIC, sizeof(cMAGIC)) != 0 || data[4] != cVERSION)
+  {
+    return false;
+  }
+  std::memcpy(&byte_order_mark, data + 8, sizeof(byte_order_mark));
+  if (byte_order_mark != cBYTE_ORDER_MARK)
+  {
+    return false;
+  }
+  uint16_t number_of_pose_values;
+  uint16_t number_of_covariance_values;
+  uint32_t record_size;
+  std::memcpy(&number_of_pose_values, data + 12, sizeof(number_of_pose_values));
+  std::memcpy(&number_of_covariance_values, data + 14, sizeof(number_of_covariance_values));
+  std::memcpy(&record_size, data + 16, sizeof(record_size));
+  header.dimension = data[5];
+  header.element_size = data[6];
+  header.floating_point_elements = data[7] != 0;
+  header.number_of_pose_values = number_of_pose_values;
+  header.number_of_covariance_values = number_of_covariance_values;
+  header.record_size = record_size;
+  return record_size > 0;
+}
+
+//----------------------------------------------------------------------
+// End of namespace trajectory_store
+//----------------------------------------------------------------------
+}
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+template class tTrajectoryStoreWriter<tPose2D<>>;
+template class tTrajectoryStoreWriter<tPose3D<>>;
+template class tTrajectoryStoreWriter<tUncertainPose2D<>>;
+template class tTrajectoryStoreWriter<tUncertainPose3D<>>;
+template class tTrajectoryStore<tPose2D<>>;
+template class tTrajectoryStore<tPose3D<>>;
+template class tTrajectoryStore<tUncertainPose2D<>>;
+template class tTrajectoryStore<tUncertainPose3D<>>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
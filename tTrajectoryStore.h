@@ -0,0 +1,474 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectoryStore.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains \ref rrlib::localization::tTrajectoryStoreWriter and \ref rrlib::localization::tTrajectoryStore
+ *
+ * \b tTrajectoryStoreWriter
+ *
+ * Writes timestamped poses as fixed size records of raw values, i.e. the
+ * timestamp in ns followed by the in-memory representation of the pose.
+ * A header describes the dimension, the element type and whether
+ * covariances are stored, so a file can only be opened with the pose
+ * type it was written with.
+ *
+ * \b tTrajectoryStore
+ *
+ * Maps such a file into memory for offline analysis of large recordings.
+ * Records are not parsed, but they are copied out: the iterators copy the
+ * raw bytes of a record into the pose they yield, as the records within the
+ * mapping are not aligned for the pose type. Time ranges are found by binary
+ * search and returned as iterator ranges.
+ *
+ * In contrast to \ref tTrajectoryLogWriter the files are not compressed,
+ * but every record is accessible in constant time. As the raw memory
+ * layout is stored, files are not portable between platforms of
+ * different byte order, which is detected when opening them.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__tTrajectoryStore_h__
+#define __rrlib__localization__tTrajectoryStore_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/time/time.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tPose.h"
+#include "rrlib/localization/tUncertainPose.h"
+#include "rrlib/localization/tTrajectoryLog.h"
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+namespace trajectory_store
+{
+
+//! The description of the records stored at the beginning of each file
+struct tHeader
+{
+  size_t dimension;
+  bool floating_point_elements;
+  size_t element_size;
+  size_t number_of_pose_values;
+  size_t number_of_covariance_values;
+  size_t record_size;
+};
+
+const size_t cHEADER_SIZE = 64;
+const size_t cTIMESTAMP_SIZE = sizeof(int64_t);
+
+void WriteHeader(const tHeader &header, uint8_t(&buffer)[cHEADER_SIZE]);
+
+//! Read and check the header
+/*! \returns Whether data starts with a valid header that was written on a platform with the same byte order
+ */
+bool ReadHeader(const uint8_t *data, size_t size, tHeader &header);
+
+//! Get the header that describes records of TPose
+template <typename TPose>
+tHeader GetHeader()
+{
+  typedef typename TPose::tElement tElement;
+  const size_t number_of_pose_values = pose::GetNumberOfPoseValues(static_cast<const TPose *>(nullptr));
+  const size_t number_of_covariance_values = pose::GetNumberOfCovarianceValues(static_cast<const TPose *>(nullptr));
+  static_assert(sizeof(TPose) == (number_of_pose_values + number_of_covariance_values) * sizeof(tElement), "The pose type must consist of its raw values only");
+  return tHeader {number_of_pose_values == 3 ? 2 : 3, std::is_floating_point<tElement>::value, sizeof(tElement), number_of_pose_values, number_of_covariance_values, cTIMESTAMP_SIZE + sizeof(TPose)};
+}
+
+}
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Writes timestamped poses to a file of fixed size records for \ref tTrajectoryStore
+/*! \tparam TPose A pose type like tPose3D<> or tUncertainPose3D<>
+ */
+template <typename TPose = tPose3D<>>
+class tTrajectoryStoreWriter
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TPose tValue;
+
+  //! Create a new file
+  /*! \param file_name The file to create, which is truncated if it exists
+   *  \exception std::runtime_error if the file cannot be created
+   */
+  explicit tTrajectoryStoreWriter(const std::string &file_name);
+
+  //! Closes the file if Close was not called before
+  ~tTrajectoryStoreWriter();
+
+  tTrajectoryStoreWriter(const tTrajectoryStoreWriter &) = delete;
+  tTrajectoryStoreWriter &operator = (const tTrajectoryStoreWriter &) = delete;
+
+  inline size_t Size() const
+  {
+    return this->size;
+  }
+
+  //! Append a new sample
+  /*! \param timestamp The time of the sample, which must not be older than the previous sample
+   *  \param pose      The pose at timestamp
+   *  \returns Whether the sample was appended, i.e. false if it was older than the previous sample
+   *  \exception std::runtime_error if writing to the file fails
+   */
+  bool Append(const time::tTimestamp &timestamp, const TPose &pose);
+
+  //! Write all buffered records to the file
+  void Flush();
+
+  void Close();
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  std::FILE *file;
+  size_t size;
+  int64_t last_timestamp;
+
+};
+
+//! Read-only access to a file of \ref tTrajectoryStoreWriter via a memory mapping
+/*! \tparam TPose The pose type the file was written with
+ */
+template <typename TPose = tPose3D<>>
+class tTrajectoryStore
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef TPose tValue;
+
+  //! Iterates over the records and yields copies of their poses
+  /*! The records within the mapping are not necessarily aligned for TPose,
+   *  so dereferencing copies the raw bytes into a new pose. As that is not a
+   *  reference, the iterator is only an input iterator for the standard
+   *  library, although it supports constant time jumps and differences.
+   */
+  class tIterator
+  {
+  public:
+
+    //! Allows it->X() on the pose that is returned by value
+    class tPointer
+    {
+    public:
+      explicit tPointer(const TPose &pose) :
+        pose(pose)
+      {}
+      inline const TPose *operator -> () const
+      {
+        return &this->pose;
+      }
+    private:
+      TPose pose;
+    };
+
+    typedef std::input_iterator_tag iterator_category;
+    typedef TPose value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef tPointer pointer;
+    typedef TPose reference;
+
+    tIterator() :
+      record(nullptr)
+    {}
+
+    explicit tIterator(const uint8_t *record) :
+      record(record)
+    {}
+
+    inline time::tTimestamp Timestamp() const
+    {
+      int64_t nanoseconds;
+      std::memcpy(&nanoseconds, this->record, sizeof(nanoseconds));
+      return trajectory_log::FromNanoseconds(nanoseconds);
+    }
+
+    inline reference operator * () const
+    {
+      TPose pose;
+      std::memcpy(static_cast<void *>(&pose), this->record + trajectory_store::cTIMESTAMP_SIZE, sizeof(TPose));
+      return pose;
+    }
+
+    inline pointer operator -> () const
+    {
+      return tPointer(**this);
+    }
+
+    inline reference operator [](difference_type offset) const
+    {
+      return *(*this + offset);
+    }
+
+    inline tIterator &operator ++ ()
+    {
+      this->record += cRECORD_SIZE;
+      return *this;
+    }
+
+    inline tIterator operator ++ (int)
+    {
+      tIterator result(*this);
+      ++*this;
+      return result;
+    }
+
+    inline tIterator &operator -- ()
+    {
+      this->record -= cRECORD_SIZE;
+      return *this;
+    }
+
+    inline tIterator operator -- (int)
+    {
+      tIterator result(*this);
+      --*this;
+      return result;
+    }
+
+    inline tIterator &operator += (difference_type offset)
+    {
+      this->record += offset * static_cast<difference_type>(cRECORD_SIZE);
+      return *this;
+    }
+
+    inline tIterator &operator -= (difference_type offset)
+    {
+      return *this += -offset;
+    }
+
+    inline tIterator operator + (difference_type offset) const
+    {
+      return tIterator(*this) += offset;
+    }
+
+    inline tIterator operator - (difference_type offset) const
+    {
+      return tIterator(*this) -= offset;
+    }
+
+    inline difference_type operator - (const tIterator &other) const
+    {
+      return (this->record - other.record) / static_cast<difference_type>(cRECORD_SIZE);
+    }
+
+    inline bool operator == (const tIterator &other) const
+    {
+      return this->record == other.record;
+    }
+
+    inline bool operator != (const tIterator &other) const
+    {
+      return this->record != other.record;
+    }
+
+    inline bool operator < (const tIterator &other) const
+    {
+      return this->record < other.record;
+    }
+
+    inline bool operator > (const tIterator &other) const
+    {
+      return other < *this;
+    }
+
+    inline bool operator <= (const tIterator &other) const
+    {
+      return !(other < *this);
+    }
+
+    inline bool operator >= (const tIterator &other) const
+    {
+      return !(*this < other);
+    }
+
+  private:
+
+    const uint8_t *record;
+
+  };
+
+  //! A contiguous range of records, e.g. the result of \ref GetRange
+  class tRange
+  {
+  public:
+
+    tRange(const tIterator &begin, const tIterator &end) :
+      first(begin),
+      last(end)
+    {}
+
+    inline tIterator begin() const
+    {
+      return this->first;
+    }
+
+    inline tIterator end() const
+    {
+      return this->last;
+    }
+
+    inline size_t Size() const
+    {
+      return this->last - this->first;
+    }
+
+    inline bool Empty() const
+    {
+      return this->first == this->last;
+    }
+
+  private:
+
+    tIterator first;
+    tIterator last;
+
+  };
+
+  //! Open a file
+  /*! If the writer was not closed properly, an incomplete last record is ignored.
+   *  \exception std::runtime_error if the file cannot be mapped or contains another pose type
+   */
+  explicit tTrajectoryStore(const std::string &file_name);
+
+  inline size_t Size() const
+  {
+    return this->size;
+  }
+
+  inline bool Empty() const
+  {
+    return this->size == 0;
+  }
+
+  inline tIterator begin() const
+  {
+    return tIterator(this->records);
+  }
+
+  inline tIterator end() const
+  {
+    return tIterator(this->records + this->size * cRECORD_SIZE);
+  }
+
+  inline TPose operator[](size_t index) const
+  {
+    assert(index < this->size);
+    return this->begin()[index];
+  }
+
+  inline time::tTimestamp Timestamp(size_t index) const
+  {
+    assert(index < this->size);
+    return (this->begin() + index).Timestamp();
+  }
+
+  //! Get the index of the first record that is not older than timestamp
+  /*! \returns The index in [0, Size()], where Size() means that all records are older
+   */
+  size_t LowerBound(const time::tTimestamp &timestamp) const;
+
+  //! Get the index of the first record that is newer than timestamp
+  /*! \returns The index in [0, Size()], where Size() means that no record is newer
+   */
+  size_t UpperBound(const time::tTimestamp &timestamp) const;
+
+  //! Get all records within [begin, end]
+  tRange GetRange(const time::tTimestamp &begin, const time::tTimestamp &end) const;
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  static const size_t cRECORD_SIZE = trajectory_store::cTIMESTAMP_SIZE + sizeof(TPose);
+
+  trajectory_log::tMappedFile file;
+  const uint8_t *records;
+  size_t size;
+
+};
+
+//----------------------------------------------------------------------
+// Explicit template instantiation
+//----------------------------------------------------------------------
+
+extern template class tTrajectoryStoreWriter<tPose2D<>>;
+extern template class tTrajectoryStoreWriter<tPose3D<>>;
+extern template class tTrajectoryStoreWriter<tUncertainPose2D<>>;
+extern template class tTrajectoryStoreWriter<tUncertainPose3D<>>;
+extern template class tTrajectoryStore<tPose2D<>>;
+extern template class tTrajectoryStore<tPose3D<>>;
+extern template class tTrajectoryStore<tUncertainPose2D<>>;
+extern template class tTrajectoryStore<tUncertainPose3D<>>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/tTrajectoryStore.hpp"
+
+#endif
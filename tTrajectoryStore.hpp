@@ -0,0 +1,242 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tTrajectoryStore.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <stdexcept>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+template <typename TPose>
+const size_t tTrajectoryStore<TPose>::cRECORD_SIZE;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tTrajectoryStoreWriter constructors
+//----------------------------------------------------------------------
+template <typename TPose>
+tTrajectoryStoreWriter<TPose>::tTrajectoryStoreWriter(const std::string &file_name) :
+  file(std::fopen(file_name.c_str(), "wb")),
+  size(0),
+  last_timestamp(0)
+{
+  if (!this->file)
+  {
+    throw std::runtime_error("Could not create trajectory store '" + file_name + "'");
+  }
+  uint8_t header[trajectory_store::cHEADER_SIZE];
+  trajectory_store::WriteHeader(trajectory_store::GetHeader<TPose>(), header);
+  if (std::fwrite(header, 1, sizeof(header), this->file) != sizeof(header))
+  {
+    std::fclose(this->file);
+    throw std::runtime_error("Could not write trajectory store '" + file_name + "'");
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStoreWriter destructor
+//----------------------------------------------------------------------
+template <typename TPose>
+tTrajectoryStoreWriter<TPose>::~tTrajectoryStoreWriter()
+{
+  if (this->file)
+  {
+    try
+    {
+      this->Close();
+    }
+    catch (const std::runtime_error &)
+    {}
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStoreWriter Append
+//----------------------------------------------------------------------
+template <typename TPose>
+bool tTrajectoryStoreWriter<TPose>::Append(const time::tTimestamp &timestamp, const TPose &pose)
+{
+  assert(this->file);
+  const int64_t nanoseconds = trajectory_log::ToNanoseconds(timestamp);
+  if (this->size > 0 && nanoseconds < this->last_timestamp)
+  {
+    return false;
+  }
+  if (std::fwrite(&nanoseconds, sizeof(nanoseconds), 1, this->file) != 1 || std::fwrite(&pose, sizeof(TPose), 1, this->file) != 1)
+  {
+    throw std::runtime_error("Could not write trajectory store");
+  }
+  this->last_timestamp = nanoseconds;
+  this->size++;
+  return true;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStoreWriter Flush
+//----------------------------------------------------------------------
+template <typename TPose>
+void tTrajectoryStoreWriter<TPose>::Flush()
+{
+  assert(this->file);
+  if (std::fflush(this->file) != 0)
+  {
+    throw std::runtime_error("Could not write trajectory store");
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStoreWriter Close
+//----------------------------------------------------------------------
+template <typename TPose>
+void tTrajectoryStoreWriter<TPose>::Close()
+{
+  assert(this->file);
+  std::FILE *handle = this->file;
+  this->file = nullptr;
+  if (std::fclose(handle) != 0)
+  {
+    throw std::runtime_error("Could not write trajectory store");
+  }
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStore constructors
+//----------------------------------------------------------------------
+template <typename TPose>
+tTrajectoryStore<TPose>::tTrajectoryStore(const std::string &file_name) :
+  file(file_name),
+  records(nullptr),
+  size(0)
+{
+  trajectory_store::tHeader header;
+  if (!trajectory_store::ReadHeader(this->file.Data(), this->file.Size(), header))
+  {
+    throw std::runtime_error("'" + file_name + "' is no trajectory store of this platform");
+  }
+  const trajectory_store::tHeader expected = trajectory_store::GetHeader<TPose>();
+  if (header.dimension != expected.dimension || header.floating_point_elements != expected.floating_point_elements || header.element_size != expected.element_size ||
+      header.number_of_pose_values != expected.number_of_pose_values || header.number_of_covariance_values != expected.number_of_covariance_values ||
+      header.record_size != cRECORD_SIZE)
+  {
+    throw std::runtime_error("'" + file_name + "' contains another pose type");
+  }
+  this->records = this->file.Data() + trajectory_store::cHEADER_SIZE;
+  this->size = (this->file.Size() - trajectory_store::cHEADER_SIZE) / cRECORD_SIZE;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStore LowerBound
+//----------------------------------------------------------------------
+template <typename TPose>
+size_t tTrajectoryStore<TPose>::LowerBound(const time::tTimestamp &timestamp) const
+{
+  size_t begin = 0;
+  size_t end = this->size;
+  while (begin < end)
+  {
+    const size_t middle = begin + (end - begin) / 2;
+    if (this->Timestamp(middle) < timestamp)
+    {
+      begin = middle + 1;
+    }
+    else
+    {
+      end = middle;
+    }
+  }
+  return begin;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStore UpperBound
+//----------------------------------------------------------------------
+template <typename TPose>
+size_t tTrajectoryStore<TPose>::UpperBound(const time::tTimestamp &timestamp) const
+{
+  size_t begin = 0;
+  size_t end = this->size;
+  while (begin < end)
+  {
+    const size_t middle = begin + (end - begin) / 2;
+    if (timestamp < this->Timestamp(middle))
+    {
+      end = middle;
+    }
+    else
+    {
+      begin = middle + 1;
+    }
+  }
+  return begin;
+}
+
+//----------------------------------------------------------------------
+// tTrajectoryStore GetRange
+//----------------------------------------------------------------------
+template <typename TPose>
+typename tTrajectoryStore<TPose>::tRange tTrajectoryStore<TPose>::GetRange(const time::tTimestamp &begin, const time::tTimestamp &end) const
+{
+  const size_t first = this->LowerBound(begin);
+  const size_t last = std::max(first, this->UpperBound(end));
+  return tRange(this->begin() + first, this->begin() + last);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -76,6 +76,11 @@ template class tUncertainPose<3, float, si_units::tMeter, si_units::tNoUnit, mat
 template class tUncertainPose < 3, double, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 template class tUncertainPose < 3, float, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 
+template class tPackedUncertainPose<2, double, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+template class tPackedUncertainPose<2, float, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+template class tPackedUncertainPose<3, double, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+template class tPackedUncertainPose<3, float, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -45,6 +45,8 @@
 
 #include "rrlib/localization/pose/tUncertainPose2D.h"
 #include "rrlib/localization/pose/tUncertainPose3D.h"
+#include "rrlib/localization/pose/tPackedUncertainPose2D.h"
+#include "rrlib/localization/pose/tPackedUncertainPose3D.h"
 
 #undef __rrlib__localization__uncertain_pose__include_guard__
 
@@ -92,6 +94,18 @@ using tUncertainPoseChange3D = tUncertainPose < 3, TElement, si_units::tSIUnit <
 template <typename TElement = double, typename TAutoWrapPolicy = math::angle::NoWrap>
 using tUncertainTwist3D = tUncertainPoseChange3D<TElement, TAutoWrapPolicy>;
 
+//! The standard uncertain pose with packed covariance for the two dimensional case.
+/*! For further documentation, see \ref rrlib::localization::tPackedUncertainPose< 2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy >
+ */
+template <typename TElement = double, typename TAutoWrapPolicy = math::angle::Signed>
+using tPackedUncertainPose2D = tPackedUncertainPose<2, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy>;
+
+//! The standard uncertain pose with packed covariance for the three dimensional case.
+/*! For further documentation, see \ref rrlib::localization::tPackedUncertainPose< 3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy >
+ */
+template <typename TElement = double, typename TAutoWrapPolicy = math::angle::Signed>
+using tPackedUncertainPose3D = tPackedUncertainPose<3, TElement, si_units::tMeter, si_units::tNoUnit, TAutoWrapPolicy>;
+
 //----------------------------------------------------------------------
 // Arithmetic operators
 //----------------------------------------------------------------------
@@ -144,6 +158,11 @@ extern template class tUncertainPose<3, float, si_units::tMeter, si_units::tNoUn
 extern template class tUncertainPose < 3, double, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 extern template class tUncertainPose < 3, float, si_units::tSIUnit < 1, 0, -1, 0, 0, 0, 0 > , si_units::tHertz, math::angle::NoWrap >;
 
+extern template class tPackedUncertainPose<2, double, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+extern template class tPackedUncertainPose<2, float, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+extern template class tPackedUncertainPose<3, double, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+extern template class tPackedUncertainPose<3, float, si_units::tMeter, si_units::tNoUnit, math::angle::Signed>;
+
 //----------------------------------------------------------------------
 // End of namespace declaration
 //----------------------------------------------------------------------
@@ -0,0 +1,155 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tVehicleOdometry.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Contains \ref rrlib::localization::tVehicleOdometry
+ *
+ * \b tVehicleOdometry
+ *
+ * Successor of \ref tOdometry for vehicles that report their velocity,
+ * yaw rate and side slip angle. It works on \ref tPose3D and
+ * rrlib::time instead of rrlib::math::tPose3D, util::tTime and a float
+ * interval, and integrates with the mean kernels of \ref tDeadReckoning:
+ * the mean of the previous and the current twist is moved along an arc
+ * for the elapsed time, which is computed in double precision.
+ *
+ * Migration from tOdometry:
+ *  - UpdateTime + UpdatePose    -> UpdatePose(velocity, yaw rate, side slip angle, timestamp)
+ *  - CurrentPoseWcs             -> GetPose
+ *  - CorrectPose (data_select 1) -> SetPose
+ *  - VelocityVectorWcs          -> GetTwist, in the frame of the vehicle
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__tVehicleOdometry_h__
+#define __rrlib__localization__tVehicleOdometry_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/time/time.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tPose.h"
+#include "rrlib/localization/tDeadReckoning.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Class declaration
+//----------------------------------------------------------------------
+//! Odometry of a vehicle from its velocity, yaw rate and side slip angle
+template <typename TElement = double>
+class tVehicleOdometry
+{
+
+//----------------------------------------------------------------------
+// Public methods and typedefs
+//----------------------------------------------------------------------
+public:
+
+  typedef tPose3D<TElement> tPose;
+  typedef tTwist3D<TElement> tTwist;
+
+  explicit tVehicleOdometry(const tPose &initial_pose = tPose());
+
+  //! The integrated pose
+  inline const tPose &GetPose() const
+  {
+    return this->pose;
+  }
+
+  //! Replace the integrated pose, e.g. by a corrected one
+  inline void SetPose(const tPose &pose)
+  {
+    this->pose = pose;
+  }
+
+  //! The twist of the latest update in the frame of the vehicle
+  inline const tTwist &GetTwist() const
+  {
+    return this->twist;
+  }
+
+  //! Forget the previous twist and timestamp
+  /*! The next update with a timestamp only stores it together with the
+   *  twist. The next update with a duration integrates the current twist
+   *  over the whole interval.
+   */
+  void ResetTwist();
+
+  //! Integrate the motion since the previous update
+  /*! \param velocity         The velocity of the vehicle in m/s
+   *  \param angular_velocity The yaw rate in rad/s
+   *  \param side_slip_angle  The angle between heading and direction of motion in rad
+   *  \param elapsed_time     The time since the previous update
+   */
+  void UpdatePose(TElement velocity, TElement angular_velocity, TElement side_slip_angle, const rrlib::time::tDuration &elapsed_time);
+
+  //! Integrate the motion since the previous update with the velocities measured at timestamp
+  /*! \returns Whether the pose was updated, which is not the case for the first call
+   *           after construction or ResetTwist, or if timestamp is older than the previous one
+   */
+  bool UpdatePose(TElement velocity, TElement angular_velocity, TElement side_slip_angle, const rrlib::time::tTimestamp &timestamp);
+
+//----------------------------------------------------------------------
+// Private fields and methods
+//----------------------------------------------------------------------
+private:
+
+  tPose pose;
+  tTwist twist;
+  tTwist previous_twist;
+  bool previous_twist_available;
+  rrlib::time::tTimestamp previous_timestamp;
+  bool previous_timestamp_available;
+
+};
+
+extern template class tVehicleOdometry<double>;
+extern template class tVehicleOdometry<float>;
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/tVehicleOdometry.hpp"
+
+#endif
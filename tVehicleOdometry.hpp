@@ -0,0 +1,129 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tVehicleOdometry.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cmath>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// tVehicleOdometry constructors
+//----------------------------------------------------------------------
+template <typename TElement>
+tVehicleOdometry<TElement>::tVehicleOdometry(const tPose &initial_pose) :
+  pose(initial_pose),
+  previous_twist_available(false),
+  previous_timestamp_available(false)
+{}
+
+//----------------------------------------------------------------------
+// tVehicleOdometry ResetTwist
+//----------------------------------------------------------------------
+template <typename TElement>
+void tVehicleOdometry<TElement>::ResetTwist()
+{
+  this->previous_twist_available = false;
+  this->previous_timestamp_available = false;
+}
+
+//----------------------------------------------------------------------
+// tVehicleOdometry UpdatePose
+//----------------------------------------------------------------------
+template <typename TElement>
+void tVehicleOdometry<TElement>::UpdatePose(TElement velocity, TElement angular_velocity, TElement side_slip_angle, const rrlib::time::tDuration &elapsed_time)
+{
+  typedef typename tTwist::template tOrientationComponent<> tAngularVelocity;
+
+  this->previous_twist = this->twist;
+  this->twist.SetPosition(velocity * std::cos(side_slip_angle), velocity * std::sin(side_slip_angle), 0);
+  this->twist.SetOrientation(tAngularVelocity(0), tAngularVelocity(0), tAngularVelocity(angular_velocity));
+
+  if (elapsed_time > rrlib::time::tDuration::zero())
+  {
+    if (this->previous_twist_available)
+    {
+      tGenericDeadReckoning<TElement>::UpdateMean(this->pose, this->previous_twist, this->twist, elapsed_time);
+    }
+    else
+    {
+      tGenericDeadReckoning<TElement>::UpdateMean(this->pose, this->twist, elapsed_time);
+    }
+  }
+  this->previous_twist_available = true;
+}
+
+template <typename TElement>
+bool tVehicleOdometry<TElement>::UpdatePose(TElement velocity, TElement angular_velocity, TElement side_slip_angle, const rrlib::time::tTimestamp &timestamp)
+{
+  if (this->previous_timestamp_available && timestamp < this->previous_timestamp)
+  {
+    return false;
+  }
+  const bool integrate = this->previous_timestamp_available;
+  const rrlib::time::tDuration elapsed_time = integrate ? timestamp - this->previous_timestamp : rrlib::time::tDuration::zero();
+  this->previous_timestamp = timestamp;
+  this->previous_timestamp_available = true;
+  this->UpdatePose(velocity, angular_velocity, side_slip_angle, elapsed_time);
+  return integrate;
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,1181 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tests/benchmark.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * Measures the runtime of core pose operations
+ *
+ * Usage: benchmark [iterations] [--format=text|csv|json]
+ *
+ * With --format=csv or --format=json every result is written to stdout
+ * as one line ("name,ns_per_op" or a JSON object per line), so that the
+ * output of two releases can be compared by scripts. Values that keep
+ * the compiler from optimising the measured code away and other remarks
+ * always go to stderr.
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "rrlib/localization/tPose.h"
+#include "rrlib/localization/tCompactEncoding.h"
+#include "rrlib/localization/tSharedPose.h"
+#include "rrlib/localization/tDeadReckoning.h"
+#include "rrlib/localization/tOdometry.h"
+#include "rrlib/localization/tTrajectoryLog.h"
+#include "rrlib/localization/tTrajectoryStore.h"
+#include "rrlib/localization/text_conversion.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+using namespace rrlib::localization;
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+namespace
+{
+
+const size_t cDEFAULT_ITERATIONS = 1000000;
+
+enum class tOutputFormat
+{
+  TEXT,
+  CSV,
+  JSON
+};
+
+tOutputFormat output_format = tOutputFormat::TEXT;
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+//! Runs function the given number of times and returns the average runtime in ns
+template <typename TFunction>
+double MeasureNanosecondsPerOperation(size_t iterations, TFunction function)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i)
+  {
+    function(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(end - start).count() / iterations;
+}
+
+void Report(const std::string &name, double nanoseconds_per_operation)
+{
+  switch (output_format)
+  {
+  case tOutputFormat::TEXT:
+    std::cout << name << ": " << nanoseconds_per_operation << " ns/op" << std::endl;
+    break;
+  case tOutputFormat::CSV:
+    std::cout << name << "," << nanoseconds_per_operation << std::endl;
+    break;
+  case tOutputFormat::JSON:
+    std::cout << "{\"name\": \"" << name << "\", \"ns_per_op\": " << nanoseconds_per_operation << "}" << std::endl;
+    break;
+  }
+}
+
+template <typename TElement>
+const char *GetElementName();
+template <>
+const char *GetElementName<float>()
+{
+  return "float";
+}
+template <>
+const char *GetElementName<double>()
+{
+  return "double";
+}
+
+template <typename TElement>
+void SetSamplePose(tPose2D<TElement> &pose, double value)
+{
+  typedef tPose2D<TElement> tPose;
+  pose.Set(static_cast<TElement>(value), static_cast<TElement>(2 * value), typename tPose::template tOrientationComponent<>(static_cast<TElement>(0.3 * value)));
+}
+
+template <typename TElement>
+void SetSamplePose(tPose3D<TElement> &pose, double value)
+{
+  typedef tPose3D<TElement> tPose;
+  pose.Set(static_cast<TElement>(value), static_cast<TElement>(2 * value), static_cast<TElement>(-value),
+           typename tPose::template tOrientationComponent<>(static_cast<TElement>(0.1 * value)),
+           typename tPose::template tOrientationComponent<>(static_cast<TElement>(-0.2 * value)),
+           typename tPose::template tOrientationComponent<>(static_cast<TElement>(0.3 * value)));
+}
+
+//! The operations every pose type offers, reported as <operation>_<dimension>d_<element>
+template <unsigned int Tdimension, typename TElement>
+void BenchmarkCoreOperations(size_t iterations)
+{
+  typedef tPose<Tdimension, TElement, rrlib::si_units::tMeter, rrlib::si_units::tNoUnit, rrlib::math::angle::Signed> tPose;
+  const std::string suffix = "_" + std::to_string(Tdimension) + "d_" + GetElementName<TElement>();
+
+  tPose relative_transformation;
+  SetSamplePose(relative_transformation, 0.001);
+  tPose reference;
+  SetSamplePose(reference, 1.5);
+  tPose pose;
+  SetSamplePose(pose, 0.7);
+  double sum = 0;
+
+  Report("core_compose" + suffix, MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    pose.ApplyRelativePoseTransformation(relative_transformation);
+  }));
+  Report("core_local_frame" + suffix, MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    sum += pose.GetPoseInLocalFrame(reference).X().Value();
+  }));
+  rrlib::math::tMatrix < Tdimension + 1, Tdimension + 1, TElement > matrix;
+  Report("core_transformation_matrix" + suffix, MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    pose.GetTransformationMatrix(matrix);
+    sum += matrix[0][Tdimension];
+  }));
+  Report("core_set_from_matrix" + suffix, MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    pose.Set(matrix);
+    sum += pose.X().Value();
+  }));
+
+  const size_t round_trips = std::max<size_t>(1, iterations / 100);
+  tPose result;
+  Report("core_text_round_trip" + suffix, MeasureNanosecondsPerOperation(round_trips, [&](size_t)
+  {
+    std::stringstream stream;
+    stream << pose;
+    stream >> result;
+    sum += result.X().Value();
+  }));
+#ifdef _LIB_RRLIB_SERIALIZATION_PRESENT_
+  Report("core_binary_round_trip" + suffix, MeasureNanosecondsPerOperation(round_trips, [&](size_t)
+  {
+    rrlib::serialization::tMemoryBuffer memory_buffer;
+    rrlib::serialization::tOutputStream output_stream(memory_buffer);
+    output_stream << pose;
+    output_stream.Flush();
+    rrlib::serialization::tInputStream input_stream(memory_buffer);
+    input_stream >> result;
+    sum += result.X().Value();
+  }));
+#endif
+  std::cerr << "  checksum " << sum << std::endl;
+}
+
+template <typename TElement>
+void BenchmarkCoreDeadReckoning(size_t iterations)
+{
+  typedef tGenericDeadReckoning<TElement> tDeadReckoning;
+  typename tDeadReckoning::tTwist twist;
+  twist.SetPosition(1, static_cast<TElement>(0.1), 0);
+  twist.SetOrientation(typename tDeadReckoning::tTwist::template tOrientationComponent<>(static_cast<TElement>(0.01)), typename tDeadReckoning::tTwist::template tOrientationComponent<>(static_cast<TElement>(0.02)), typename tDeadReckoning::tTwist::template tOrientationComponent<>(static_cast<TElement>(0.3)));
+  for (size_t i = 0; i < 6; ++i)
+  {
+    twist.Covariance()[i][i] = static_cast<TElement>(1E-3);
+  }
+  const rrlib::time::tDuration elapsed_time = std::chrono::milliseconds(1);
+  typename tDeadReckoning::tPose pose;
+  Report(std::string("core_dead_reckoning_3d_") + GetElementName<TElement>(), MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    tDeadReckoning::UpdatePose(pose, twist, elapsed_time);
+  }));
+  std::cerr << "  result " << pose.X().Value() << std::endl;
+}
+
+//! The composition the closed-form ApplyRelativePoseTransformation computes, done with transformation matrices
+template <typename TPose>
+void ApplyRelativePoseTransformationUsingMatrices(TPose &pose, const TPose &relative_transformation)
+{
+  pose = TPose(pose.GetTransformationMatrix() * relative_transformation.GetTransformationMatrix());
+}
+
+void BenchmarkComposition(size_t iterations)
+{
+  const tPose2D<> relative_2d(0.001, 0.0002, rrlib::math::tAngleDeg(0.05));
+  tPose2D<> pose_2d;
+  Report("compose_2d_matrices", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    ApplyRelativePoseTransformationUsingMatrices(pose_2d, relative_2d);
+  }));
+  std::cerr << "  result " << pose_2d << std::endl;
+  pose_2d.Reset();
+  Report("compose_2d_closed_form", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    pose_2d.ApplyRelativePoseTransformation(relative_2d);
+  }));
+  std::cerr << "  result " << pose_2d << std::endl;
+
+  const tPose3D<> relative_3d(0.001, 0.0002, 0.0001, rrlib::math::tAngleDeg(0.01), rrlib::math::tAngleDeg(0.02), rrlib::math::tAngleDeg(0.05));
+  tPose3D<> pose_3d;
+  Report("compose_3d_matrices", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    ApplyRelativePoseTransformationUsingMatrices(pose_3d, relative_3d);
+  }));
+  std::cerr << "  result " << pose_3d << std::endl;
+  pose_3d.Reset();
+  Report("compose_3d_closed_form", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    pose_3d.ApplyRelativePoseTransformation(relative_3d);
+  }));
+  std::cerr << "  result " << pose_3d << std::endl;
+
+  const tQuaternionPose<> relative_quaternion(relative_3d);
+  tQuaternionPose<> pose_quaternion;
+  Report("compose_3d_quaternion", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    pose_quaternion.ApplyRelativePoseTransformation(relative_quaternion);
+  }));
+  std::cerr << "  result " << pose_quaternion << std::endl;
+}
+
+//! GetPoseInLocalFrame as it was done before tPose got its rigid inverse
+template <typename TPose>
+TPose GetPoseInLocalFrameUsingMatrices(const TPose &pose, const TPose &reference)
+{
+  return TPose(reference.GetTransformationMatrix().Inverse() * pose.GetTransformationMatrix());
+}
+
+void BenchmarkLocalFrame(size_t iterations)
+{
+  const tPose3D<> reference(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+  tPose3D<> pose(4, 0, 0.5, rrlib::math::tAngleDeg(100), rrlib::math::tAngleDeg(-30), rrlib::math::tAngleDeg(50));
+  double sum = 0;
+  Report("local_frame_3d_matrices", MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+  {
+    pose.X() = tPose3D<>::tPositionComponent<>(i * 1E-6);
+    sum += GetPoseInLocalFrameUsingMatrices(pose, reference).X().Value();
+  }));
+  Report("local_frame_3d_rigid_inverse", MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+  {
+    pose.X() = tPose3D<>::tPositionComponent<>(i * 1E-6);
+    sum -= pose.GetPoseInLocalFrame(reference).X().Value();
+  }));
+  std::cerr << "  checksum " << sum << std::endl;
+}
+
+
+void BenchmarkBatchTransformation(size_t iterations)
+{
+  const size_t cPOINTS = 1000;
+  const tPose3D<> reference(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+  std::vector<tPosition3D<>> positions;
+  for (size_t i = 0; i < cPOINTS; ++i)
+  {
+    positions.push_back(tPosition3D<>(0.01 * i, 2 - 0.02 * i, 0.5));
+  }
+  std::vector<tPosition3D<>> result(positions.size());
+  const size_t batches = std::max<size_t>(1, iterations / cPOINTS);
+
+  Report("transform_positions_single", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+      result[i] = tPose3D<>(positions[i].X(), positions[i].Y(), positions[i].Z()).GetPoseInParentFrame(reference).Position();
+    }
+  }) / cPOINTS);
+  Report("transform_positions_batch", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    TransformPositions(reference, positions.data(), positions.size(), result.data());
+  }) / cPOINTS);
+  std::cerr << "  result " << result.back() << std::endl;
+}
+
+void BenchmarkEulerExtraction(size_t iterations)
+{
+  const size_t cMATRICES = 1000;
+  std::vector<rrlib::math::tMatrix<3, 3, double>> matrices(cMATRICES);
+  std::vector<double[3][3]> rotations(cMATRICES);
+  for (size_t i = 0; i < cMATRICES; ++i)
+  {
+    rrlib::localization::orientation::GetRotationMatrix(rotations[i], 0.001 * i, 0.0015 * i - 0.7, -0.003 * i);
+    matrices[i] = rrlib::math::tMatrix<3, 3, double>(rotations[i][0][0], rotations[i][0][1], rotations[i][0][2], rotations[i][1][0], rotations[i][1][1], rotations[i][1][2], rotations[i][2][0], rotations[i][2][1], rotations[i][2][2]);
+  }
+  std::vector<double> roll(cMATRICES), pitch(cMATRICES), yaw(cMATRICES);
+  const size_t batches = std::max<size_t>(1, iterations / cMATRICES);
+
+  Report("euler_extraction_generic", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    for (size_t i = 0; i < cMATRICES; ++i)
+    {
+      rrlib::math::tAngle<double, rrlib::math::angle::Radian> angles[3];
+      matrices[i].ExtractRollPitchYaw(angles[0], angles[1], angles[2], false, 1E-6);
+      roll[i] = angles[0].Value();
+    }
+  }) / cMATRICES);
+  Report("euler_extraction_orthonormal", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    for (size_t i = 0; i < cMATRICES; ++i)
+    {
+      rrlib::localization::orientation::ExtractRollPitchYaw(rotations[i], roll[i], pitch[i], yaw[i]);
+    }
+  }) / cMATRICES);
+  Report("euler_extraction_orthonormal_batch", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    rrlib::localization::orientation::ExtractRollPitchYaw(rotations.data(), cMATRICES, roll.data(), pitch.data(), yaw.data());
+  }) / cMATRICES);
+  std::cerr << "  result " << roll.back() << " " << pitch.back() << " " << yaw.back() << std::endl;
+}
+
+void BenchmarkPoseWithCache(size_t iterations)
+{
+  const size_t cQUERIES_PER_UPDATE = 20;
+  tPose3D<> reference(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+  tPoseWithCache<> cached_reference(reference);
+  const tPosition3D<> position(0.3, -1.2, 2.5);
+  double sum = 0;
+
+  Report("repeated_parent_frame", MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+  {
+    if (i % cQUERIES_PER_UPDATE == 0)
+    {
+      reference.Yaw() = rrlib::math::tAngleDeg(0.001 * i);
+    }
+    sum += tPose3D<>(position.X(), position.Y(), position.Z()).GetPoseInParentFrame(reference).X().Value();
+  }));
+  Report("repeated_parent_frame_cached", MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+  {
+    if (i % cQUERIES_PER_UPDATE == 0)
+    {
+      cached_reference.SetYaw(rrlib::math::tAngleDeg(0.001 * i));
+    }
+    sum -= cached_reference.TransformToParentFrame(position).X().Value();
+  }));
+  std::cerr << "  checksum " << sum << std::endl;
+}
+
+void BenchmarkInterpolation(size_t iterations)
+{
+  const size_t cSAMPLES = 1000;
+  const tPose3D<> start(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(170));
+  const tPose3D<> end(1.1, 2.05, 3, rrlib::math::tAngleDeg(11), rrlib::math::tAngleDeg(-39), rrlib::math::tAngleDeg(175));
+  std::vector<double> factors(cSAMPLES);
+  for (size_t i = 0; i < cSAMPLES; ++i)
+  {
+    factors[i] = double(i) / cSAMPLES;
+  }
+  std::vector<tPose3D<>> result(cSAMPLES);
+  const size_t batches = std::max<size_t>(1, iterations / cSAMPLES);
+
+  const std::pair<const char *, tInterpolationMethod> methods[] = { { "slerp", eIM_SLERP }, { "nlerp", eIM_NLERP }, { "geodesic", eIM_GEODESIC } };
+  for (auto &method : methods)
+  {
+    Report(std::string("interpolate_3d_") + method.first, MeasureNanosecondsPerOperation(batches, [&](size_t)
+    {
+      for (size_t i = 0; i < cSAMPLES; ++i)
+      {
+        result[i] = Interpolate(start, end, factors[i], method.second);
+      }
+    }) / cSAMPLES);
+    Report(std::string("interpolate_3d_") + method.first + "_batch", MeasureNanosecondsPerOperation(batches, [&](size_t)
+    {
+      Interpolate(start, end, factors.data(), cSAMPLES, result.data(), method.second);
+    }) / cSAMPLES);
+  }
+  std::cerr << "  result " << result.back() << std::endl;
+}
+
+void BenchmarkPoseArray(size_t iterations)
+{
+  const size_t cPOSES = 1000;
+  const tPose2D<> reference(1, 5, rrlib::math::tAngleDeg(110));
+  std::vector<tPose2D<>> poses;
+  tPoseArray2D<> pose_array;
+  for (size_t i = 0; i < cPOSES; ++i)
+  {
+    poses.push_back(tPose2D<>(0.01 * i, 2 - 0.02 * i, rrlib::math::tAngleDeg(0.3 * i)));
+    pose_array.PushBack(poses.back());
+  }
+  std::vector<tPose2D<>> result(poses.size());
+  tPoseArray2D<> result_array;
+  std::vector<double> distances(cPOSES);
+  const size_t batches = std::max<size_t>(1, iterations / cPOSES);
+
+  Report("local_frame_2d_aos", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    for (size_t i = 0; i < poses.size(); ++i)
+    {
+      result[i] = poses[i].GetPoseInLocalFrame(reference);
+    }
+  }) / cPOSES);
+  Report("local_frame_2d_soa", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    pose_array.GetPosesInLocalFrame(reference, result_array);
+  }) / cPOSES);
+  Report("distances_2d_aos", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    for (size_t i = 0; i < poses.size(); ++i)
+    {
+      const double dx = poses[i].X().Value() - reference.X().Value();
+      const double dy = poses[i].Y().Value() - reference.Y().Value();
+      distances[i] = std::sqrt(dx * dx + dy * dy);
+    }
+  }) / cPOSES);
+  Report("distances_2d_soa", MeasureNanosecondsPerOperation(batches, [&](size_t)
+  {
+    pose_array.GetDistances(reference.Position(), distances.data());
+  }) / cPOSES);
+  std::cerr << "  result " << result.back() << " " << result_array[cPOSES - 1] << " " << distances.back() << std::endl;
+}
+
+//! Dead reckoning with the covariance propagated by dense 6x6 Jacobians
+void UpdatePoseUsingDenseJacobians(tUncertainPose3D<> &pose, const tUncertainTwist3D<> &twist, double elapsed_time)
+{
+  double rotation[3][3];
+  rrlib::localization::orientation::GetRotationMatrix(rotation, pose.Roll().Value().Value(), pose.Pitch().Value().Value(), pose.Yaw().Value().Value());
+  double parent_rate[3][3];
+  rrlib::localization::orientation::GetParentFrameAngularRateMatrix(parent_rate, pose.Pitch().Value().Value(), pose.Yaw().Value().Value());
+  const double previous_position[3] = { pose.X().Value(), pose.Y().Value(), pose.Z().Value() };
+
+  pose.ApplyRelativePoseTransformation(twist * rrlib::si_units::tTime<double>(elapsed_time));
+
+  const double t[3] = { pose.X().Value() - previous_position[0], pose.Y().Value() - previous_position[1], pose.Z().Value() - previous_position[2] };
+  const double negative_skew_translation[3][3] = { { 0, t[2], -t[1] }, { -t[2], 0, t[0] }, { t[1], -t[0], 0 } };
+  double inverse_parent_rate[3][3], local_rate[3][3], inverse_local_rate[3][3];
+  rrlib::localization::orientation::GetInverseParentFrameAngularRateMatrix(inverse_parent_rate, pose.Pitch().Value().Value(), pose.Yaw().Value().Value());
+  rrlib::localization::orientation::GetLocalFrameAngularRateMatrix(local_rate, twist.Roll().Value().Value() * elapsed_time, twist.Pitch().Value().Value() * elapsed_time);
+  rrlib::localization::orientation::GetInverseLocalFrameAngularRateMatrix(inverse_local_rate, pose.Roll().Value().Value(), pose.Pitch().Value().Value());
+
+  double pose_jacobian[6][6] = {};
+  double twist_jacobian[6][6] = {};
+  for (size_t i = 0; i < 3; ++i)
+  {
+    pose_jacobian[i][i] = 1;
+    for (size_t j = 0; j < 3; ++j)
+    {
+      for (size_t k = 0; k < 3; ++k)
+      {
+        pose_jacobian[i][3 + j] += negative_skew_translation[i][k] * parent_rate[k][j];
+        pose_jacobian[3 + i][3 + j] += inverse_parent_rate[i][k] * parent_rate[k][j];
+        twist_jacobian[3 + i][3 + j] += inverse_local_rate[i][k] * local_rate[k][j] * elapsed_time;
+      }
+      twist_jacobian[i][j] = rotation[i][j] * elapsed_time;
+    }
+  }
+
+  double temp[6][6] = {};
+  double covariance[6][6] = {};
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      for (size_t k = 0; k < 6; ++k)
+      {
+        temp[i][j] += pose_jacobian[i][k] * pose.Covariance()[k][j];
+      }
+    }
+  }
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      for (size_t k = 0; k < 6; ++k)
+      {
+        covariance[i][j] += temp[i][k] * pose_jacobian[j][k];
+      }
+    }
+  }
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      temp[i][j] = 0;
+      for (size_t k = 0; k < 6; ++k)
+      {
+        temp[i][j] += twist_jacobian[i][k] * twist.Covariance()[k][j];
+      }
+    }
+  }
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      for (size_t k = 0; k < 6; ++k)
+      {
+        covariance[i][j] += temp[i][k] * twist_jacobian[j][k];
+      }
+      pose.Covariance()[i][j] = covariance[i][j];
+    }
+  }
+}
+
+void BenchmarkCovariancePropagation(size_t iterations)
+{
+  tUncertainTwist3D<> twist;
+  twist.SetPosition(1, 0.1, 0);
+  twist.SetOrientation(tUncertainTwist3D<>::tOrientationComponent<>(0.01), tUncertainTwist3D<>::tOrientationComponent<>(0.02), tUncertainTwist3D<>::tOrientationComponent<>(0.3));
+  for (size_t i = 0; i < 6; ++i)
+  {
+    twist.Covariance()[i][i] = 1E-3;
+  }
+  const rrlib::time::tDuration elapsed_time = std::chrono::milliseconds(1);
+
+  tUncertainPose3D<> dense_pose;
+  Report("dead_reckoning_dense_jacobians", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    UpdatePoseUsingDenseJacobians(dense_pose, twist, 1E-3);
+  }));
+  tUncertainPose3D<> pose;
+  Report("dead_reckoning_blockwise_jacobians", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    tDeadReckoning::UpdatePose(pose, twist, elapsed_time);
+  }));
+  std::cerr << "  result " << dense_pose.CovarianceXX() << " " << pose.CovarianceXX() << std::endl;
+
+  const size_t cEDGES = 100;
+  tUncertainPose2D<> edge_2d(0.5, 0.01, rrlib::math::tAngleDeg(1), tUncertainPose2D<>::tCovarianceMatrix<>(1E-3, 0, 0, 0, 1E-3, 0, 0, 0, 1E-4));
+  tUncertainPose3D<> edge_3d(0.5, 0.01, 0.001, rrlib::math::tAngleDeg(0.1), rrlib::math::tAngleDeg(0.2), rrlib::math::tAngleDeg(1), tUncertainPose3D<>::tCovarianceMatrix<>());
+  for (size_t i = 0; i < 6; ++i)
+  {
+    edge_3d.Covariance()[i][i] = i < 3 ? 1E-3 : 1E-4;
+  }
+  const size_t chains = std::max<size_t>(1, iterations / cEDGES);
+  tUncertainPose2D<> chain_2d;
+  Report("compound_uncertain_2d", MeasureNanosecondsPerOperation(chains, [&](size_t)
+  {
+    chain_2d = tUncertainPose2D<>();
+    for (size_t i = 0; i < cEDGES; ++i)
+    {
+      chain_2d.Compound(edge_2d);
+    }
+  }) / cEDGES);
+  tUncertainPose3D<> chain_3d;
+  Report("compound_uncertain_3d", MeasureNanosecondsPerOperation(chains, [&](size_t)
+  {
+    chain_3d = tUncertainPose3D<>();
+    for (size_t i = 0; i < cEDGES; ++i)
+    {
+      chain_3d.Compound(edge_3d);
+    }
+  }) / cEDGES);
+  Report("invert_uncertain_3d", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    chain_3d.Invert();
+  }));
+  std::cerr << "  result " << chain_2d.CovarianceYY() << " " << chain_3d.CovarianceYY() << std::endl;
+}
+
+void BenchmarkPackedCovariance(size_t iterations)
+{
+  const size_t cPARTICLES = 100000;
+  double jacobian[6][6];
+  for (size_t i = 0; i < 6; ++i)
+  {
+    for (size_t j = 0; j < 6; ++j)
+    {
+      jacobian[i][j] = (i == j ? 1 : 0) + 0.01 * std::sin(i + 2.0 * j);
+    }
+  }
+  tUncertainPose3D<>::tCovarianceMatrix<> covariance;
+  for (size_t i = 0; i < 6; ++i)
+  {
+    covariance[i][i] = 1E-3;
+  }
+  std::vector<tUncertainPose3D<>::tCovarianceMatrix<>> dense(cPARTICLES, covariance);
+  std::vector<tPackedUncertainPose3D<>::tCovariance> packed(cPARTICLES, tPackedUncertainPose3D<>::tCovariance(covariance));
+  std::cerr << "  bytes per covariance " << sizeof(dense.front()) << " dense, " << sizeof(packed.front()) << " packed" << std::endl;
+
+  const size_t sweeps = std::max<size_t>(1, iterations / cPARTICLES);
+  Report("congruence_transform_dense", MeasureNanosecondsPerOperation(sweeps, [&](size_t)
+  {
+    for (auto & matrix : dense)
+    {
+      double temp[6][6] = {};
+      for (size_t i = 0; i < 6; ++i)
+      {
+        for (size_t j = 0; j < 6; ++j)
+        {
+          for (size_t k = 0; k < 6; ++k)
+          {
+            temp[i][j] += jacobian[i][k] * matrix[k][j];
+          }
+        }
+      }
+      for (size_t i = 0; i < 6; ++i)
+      {
+        for (size_t j = 0; j < 6; ++j)
+        {
+          matrix[i][j] = 0;
+          for (size_t k = 0; k < 6; ++k)
+          {
+            matrix[i][j] += temp[i][k] * jacobian[j][k];
+          }
+        }
+      }
+    }
+  }) / cPARTICLES);
+  Report("congruence_transform_packed", MeasureNanosecondsPerOperation(sweeps, [&](size_t)
+  {
+    for (auto & matrix : packed)
+    {
+      matrix.CongruenceTransform(jacobian);
+    }
+  }) / cPARTICLES);
+  std::cerr << "  result " << dense.back()[0][0] << " " << packed.back()(0, 0) << std::endl;
+}
+
+//! Dead reckoning over a synthetic trajectory with raw twist values given per step
+template <typename TDeadReckoning, typename TElement>
+double IntegrateTrajectory(TDeadReckoning &dead_reckoning, const std::vector<TElement> &values, const rrlib::time::tDuration &step)
+{
+  typedef typename TDeadReckoning::tTwist tTwist;
+  tTwist twist;
+  for (size_t i = 0; i < 6; ++i)
+  {
+    twist.Covariance()[i][i] = 1E-4;
+  }
+  return MeasureNanosecondsPerOperation(values.size() / 6, [&](size_t i)
+  {
+    const TElement *value = &values[6 * i];
+    twist.SetPosition(value[0], value[1], value[2]);
+    twist.SetOrientation(typename tTwist::template tOrientationComponent<>(value[3]), typename tTwist::template tOrientationComponent<>(value[4]), typename tTwist::template tOrientationComponent<>(value[5]));
+    dead_reckoning.UpdatePose(twist, step);
+  });
+}
+
+template <typename TPose>
+double GetDistance(const tUncertainPose3D<> &reference, const TPose &pose)
+{
+  const double dx = reference.X().Value() - pose.X().Value();
+  const double dy = reference.Y().Value() - pose.Y().Value();
+  const double dz = reference.Z().Value() - pose.Z().Value();
+  return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+void BenchmarkFloatDeadReckoning()
+{
+  // one hour at 100 Hz of a wavy drive with some roll and pitch
+  const size_t cSTEPS = 3600 * 100;
+  const rrlib::time::tDuration step = std::chrono::milliseconds(10);
+  std::vector<double> values_double(6 * cSTEPS);
+  std::vector<float> values_float(6 * cSTEPS);
+  for (size_t i = 0; i < cSTEPS; ++i)
+  {
+    const double time = i * 0.01;
+    const double values[6] = { 1 + 0.5 * std::sin(0.01 * time), 0.05 * std::sin(0.1 * time), 0.01 * std::sin(0.2 * time), 0.02 * std::sin(0.3 * time), 0.02 * std::cos(0.25 * time), 0.2 * std::sin(0.003 * time) };
+    for (size_t j = 0; j < 6; ++j)
+    {
+      values_float[6 * i + j] = static_cast<float>(values[j]);
+      values_double[6 * i + j] = values_float[6 * i + j];
+    }
+  }
+
+  tDeadReckoning reference;
+  Report("dead_reckoning_one_hour_double", IntegrateTrajectory(reference, values_double, step));
+  tGenericDeadReckoning<float> single;
+  Report("dead_reckoning_one_hour_float", IntegrateTrajectory(single, values_float, step));
+  tGenericDeadReckoning<float, double> accumulated;
+  Report("dead_reckoning_one_hour_float_accumulate_double", IntegrateTrajectory(accumulated, values_float, step));
+  std::cerr << "  drift after " << reference.GetPose().X().Value() << " m in x: float " << GetDistance(reference.GetPose(), single.GetPose()) << " m, float accumulated in double " << GetDistance(reference.GetPose(), accumulated.GetPose()) << " m" << std::endl;
+
+  // particle sets without covariances
+  const size_t cPARTICLES = 10000;
+  tGenericDeadReckoning<float>::tPoseArray particles_float(cPARTICLES);
+  tGenericDeadReckoning<float>::tTwistArray twists_float(cPARTICLES);
+  tDeadReckoning::tPoseArray particles_double(cPARTICLES);
+  tDeadReckoning::tTwistArray twists_double(cPARTICLES);
+  for (size_t i = 0; i < cPARTICLES; ++i)
+  {
+    for (size_t lane = 0; lane < 6; ++lane)
+    {
+      twists_float.Lane(lane)[i] = values_float[6 * i + lane];
+      twists_double.Lane(lane)[i] = values_double[6 * i + lane];
+    }
+  }
+  tGenericDeadReckoning<float>::tPoseArray relative_transformations_float;
+  tDeadReckoning::tPoseArray relative_transformations_double;
+  Report("dead_reckoning_particles_double", MeasureNanosecondsPerOperation(100, [&](size_t)
+  {
+    tDeadReckoning::UpdatePoses(particles_double, twists_double, step, relative_transformations_double);
+  }) / cPARTICLES);
+  Report("dead_reckoning_particles_float", MeasureNanosecondsPerOperation(100, [&](size_t)
+  {
+    tGenericDeadReckoning<float>::UpdatePoses(particles_float, twists_float, step, relative_transformations_float);
+  }) / cPARTICLES);
+}
+
+//! Drives the given odometry for duration seconds with smoothly changing velocities at the given frequency
+rrlib::math::tPose3D DriveOdometry(tOdometry &odometry, unsigned int frequency, unsigned int duration)
+{
+  for (unsigned int i = 0; i <= duration * frequency; ++i)
+  {
+    const double t = static_cast<double>(i) / frequency;
+    const rrlib::util::tTime time(i / frequency, (i % frequency) * (1000000 / frequency));
+    odometry.UpdateTime(time, time);
+    odometry.UpdatePose(1.5 + 0.5 * std::sin(0.5 * t), 0.4 * std::sin(0.3 * t), 0.02 * std::sin(t));
+  }
+  return odometry.CurrentPoseWcs();
+}
+
+void BenchmarkDeadReckoningSubSteps(size_t iterations)
+{
+  // bunched messages: a circle with radius 1 m in updates of 200 ms
+  const rrlib::time::tDuration elapsed = std::chrono::milliseconds(200);
+  tUncertainTwist3D<> twist;
+  twist.SetPosition(1, 0, 0);
+  twist.SetOrientation(tUncertainTwist3D<>::tOrientationComponent<>(0), tUncertainTwist3D<>::tOrientationComponent<>(0), tUncertainTwist3D<>::tOrientationComponent<>(1));
+  const std::pair<const char *, tDeadReckoning::tIntegrationMethod> cMETHODS[] =
+  {
+    { "dead_reckoning_200ms_trapezoid", tDeadReckoning::eDRIM_TRAPEZOID },
+    { "dead_reckoning_200ms_sub_steps", tDeadReckoning::eDRIM_SUB_STEPS },
+    { "dead_reckoning_200ms_runge_kutta", tDeadReckoning::eDRIM_RUNGE_KUTTA }
+  };
+  for (auto &method : cMETHODS)
+  {
+    tUncertainPose3D<> pose;
+    Report(method.first, MeasureNanosecondsPerOperation(iterations, [&](size_t)
+    {
+      tDeadReckoning::UpdatePose(pose, twist, elapsed, method.second, std::chrono::milliseconds(10));
+    }));
+    // after 10 s the exact position is (sin(10), 1 - cos(10))
+    pose = tUncertainPose3D<>();
+    for (size_t i = 0; i < 50; ++i)
+    {
+      tDeadReckoning::UpdatePose(pose, twist, elapsed, method.second, std::chrono::milliseconds(10));
+    }
+    std::cerr << "  " << method.first << ": error after 10 s " << std::hypot(pose.X().Value() - std::sin(10.0), pose.Y().Value() - (1 - std::cos(10.0))) << " m" << std::endl;
+  }
+}
+
+void BenchmarkDeadReckoningReplay(size_t iterations)
+{
+  // twists at 100 Hz, either in order or each one arriving five periods late
+  tUncertainTwist3D<> twist;
+  twist.SetPosition(1, 0, 0);
+  twist.SetOrientation(tUncertainTwist3D<>::tOrientationComponent<>(0), tUncertainTwist3D<>::tOrientationComponent<>(0), tUncertainTwist3D<>::tOrientationComponent<>(0.2));
+  const rrlib::time::tTimestamp start;
+  tDeadReckoning in_order;
+  Report("dead_reckoning_timestamped_in_order", MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+  {
+    in_order.UpdatePose(twist, start + std::chrono::milliseconds(10 * i));
+  }));
+  tDeadReckoning delayed;
+  for (size_t i = 0; i < 6; ++i)
+  {
+    delayed.UpdatePose(twist, start + std::chrono::milliseconds(20 * i));
+  }
+  Report("dead_reckoning_timestamped_five_late", MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+  {
+    // alternately a new twist and one that fills the gap five periods back
+    const size_t period = 12 + 2 * (i / 2) - (i % 2 ? 9 : 0);
+    delayed.UpdatePose(twist, start + std::chrono::milliseconds(10 * period));
+  }));
+}
+
+void BenchmarkOdometryIntegration(size_t iterations)
+{
+  const std::pair<tOdometry::tIntegrationMethod, const char *> cMETHODS[] =
+  {
+    { tOdometry::eOIM_EXACT_ARC, "exact_arc" },
+    { tOdometry::eOIM_TRAPEZOID, "trapezoid" },
+    { tOdometry::eOIM_MIDPOINT, "midpoint" },
+    { tOdometry::eOIM_RUNGE_KUTTA, "runge_kutta" }
+  };
+  const unsigned int cDURATION = 60;
+
+  tOdometry reference(false);
+  reference.SetIntegrationMethod(tOdometry::eOIM_RUNGE_KUTTA);
+  const rrlib::math::tPose3D expected = DriveOdometry(reference, 10000, cDURATION);
+
+  for (auto & method : cMETHODS)
+  {
+    for (unsigned int frequency : { 10, 20, 50, 100 })
+    {
+      tOdometry odometry(false);
+      odometry.SetIntegrationMethod(method.first);
+      const rrlib::math::tPose3D actual = DriveOdometry(odometry, frequency, cDURATION);
+      std::cerr << "  odometry " << method.second << " at " << frequency << " Hz: position error after " << cDURATION << " s "
+                << std::hypot(expected.X() - actual.X(), expected.Y() - actual.Y()) << " m" << std::endl;
+    }
+
+    tOdometry odometry(false);
+    odometry.SetIntegrationMethod(method.first);
+    Report(std::string("odometry_update_") + method.second, MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+    {
+      const rrlib::util::tTime time(i / 100, (i % 100) * 10000);
+      odometry.UpdateTime(time, time);
+      odometry.UpdatePose(1.5, 0.4 * std::sin(i * 1E-3), 0.);
+    }));
+    std::cerr << "  result " << odometry.CurrentPoseWcs().X() << std::endl;
+  }
+}
+
+void BenchmarkCompactEncoding(size_t iterations)
+{
+  tUncertainPose3D<> pose(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-20), rrlib::math::tAngleDeg(30), tUncertainPose3D<>::tCovarianceMatrix<>());
+  for (size_t i = 0; i < 6; ++i)
+  {
+    pose.Covariance()[i][i] = 1E-3;
+  }
+  const tCompactEncoding encoding;
+  uint8_t buffer[256];
+  tUncertainPose3D<> decoded;
+  std::cerr << "  bytes per uncertain 3D pose " << encoding.GetEncodedSize(pose) << " compact, " << 6 * sizeof(double) + sizeof(pose.Covariance()) << " raw" << std::endl;
+  Report("compact_encode_uncertain_3d", MeasureNanosecondsPerOperation(iterations, [&](size_t i)
+  {
+    pose.X() = tUncertainPose3D<>::tPositionComponent<>(i * 1E-6);
+    encoding.Encode(pose, buffer);
+  }));
+  Report("compact_decode_uncertain_3d", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    encoding.Decode(buffer, decoded);
+  }));
+  std::cerr << "  result " << decoded.X().Value() << std::endl;
+}
+
+void BenchmarkTrajectoryLog()
+{
+  // one hour at 100 Hz, reported per record
+  const size_t cRECORDS = 3600 * 100;
+  const char *cFILE_NAME = "benchmark_trajectory_log.rrtl";
+  const rrlib::time::tTimestamp start;
+  const rrlib::time::tDuration step = std::chrono::milliseconds(10);
+  {
+    tTrajectoryLogWriter<tPose3D<>> writer(cFILE_NAME);
+    tPose3D<> pose;
+    Report("trajectory_log_append_3d", MeasureNanosecondsPerOperation(cRECORDS, [&](size_t i)
+    {
+      SetSamplePose(pose, std::sin(i * 1E-4));
+      writer.Append(start + i * step, pose);
+    }));
+  }
+  std::ifstream file(cFILE_NAME, std::ios::binary | std::ios::ate);
+  std::cerr << "  bytes per record " << static_cast<double>(file.tellg()) / cRECORDS << " compressed, " << sizeof(int64_t) + 6 * sizeof(double) << " raw" << std::endl;
+
+  tTrajectoryLogReader<tPose3D<>> reader(cFILE_NAME);
+  double sum = 0;
+  const double replay = MeasureNanosecondsPerOperation(1, [&](size_t)
+  {
+    reader.ForEach([&](const rrlib::time::tTimestamp &, const tPose3D<> &pose)
+    {
+      sum += pose.X().Value();
+    });
+  }) / cRECORDS;
+  Report("trajectory_log_replay_3d", replay);
+  std::cerr << "  full day at 100 Hz replays in " << replay * 24 * 3600 * 100 * 1E-9 << " s" << std::endl;
+
+  tPose3D<> pose;
+  Report("trajectory_log_lookup_3d", MeasureNanosecondsPerOperation(10000, [&](size_t i)
+  {
+    reader.GetPose(start + (i * 7919 % cRECORDS) * step + std::chrono::milliseconds(5), pose);
+    sum += pose.Y().Value();
+  }));
+  std::cerr << "  result " << sum << std::endl;
+  std::remove(cFILE_NAME);
+}
+
+void BenchmarkTrajectoryStore()
+{
+  const size_t cRECORDS = 1000000;
+  const char *cFILE_NAME = "benchmark_trajectory_store.rrts";
+  const rrlib::time::tTimestamp start;
+  const rrlib::time::tDuration step = std::chrono::milliseconds(10);
+  {
+    tTrajectoryStoreWriter<tPose3D<>> writer(cFILE_NAME);
+    tPose3D<> pose;
+    Report("trajectory_store_append_3d", MeasureNanosecondsPerOperation(cRECORDS, [&](size_t i)
+    {
+      SetSamplePose(pose, std::sin(i * 1E-4));
+      writer.Append(start + i * step, pose);
+    }));
+  }
+
+  tTrajectoryStore<tPose3D<>> store(cFILE_NAME);
+  double sum = 0;
+  Report("trajectory_store_iterate_3d", MeasureNanosecondsPerOperation(1, [&](size_t)
+  {
+    for (const auto & pose : store)
+    {
+      sum += pose.X().Value();
+    }
+  }) / cRECORDS);
+  Report("trajectory_store_range_3d", MeasureNanosecondsPerOperation(10000, [&](size_t i)
+  {
+    sum += store.GetRange(start + (i * 7919 % cRECORDS) * step, start + (i * 7919 % cRECORDS + 100) * step).Size();
+  }));
+
+  // the text representation for comparison
+  const size_t cTEXT_RECORDS = cRECORDS / 10;
+  std::stringstream text;
+  for (size_t i = 0; i < cTEXT_RECORDS; ++i)
+  {
+    text << store[i] << std::endl;
+  }
+  tPose3D<> pose;
+  Report("trajectory_text_parse_3d", MeasureNanosecondsPerOperation(cTEXT_RECORDS, [&](size_t)
+  {
+    text >> pose;
+    sum += pose.X().Value();
+  }));
+  std::cerr << "  result " << sum << std::endl;
+  std::remove(cFILE_NAME);
+}
+
+void BenchmarkTextConversion(size_t iterations)
+{
+  tUncertainPose3D<> pose(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-20), rrlib::math::tAngleDeg(30), tUncertainPose3D<>::tCovarianceMatrix<>());
+  for (size_t i = 0; i < 6; ++i)
+  {
+    pose.Covariance()[i][i] = 1E-3;
+  }
+  std::stringstream stream;
+  stream << pose;
+  const std::string text = stream.str();
+  char buffer[1024];
+  double sum = 0;
+
+  Report("text_stream_format_uncertain_3d", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    std::stringstream output;
+    output << pose;
+    sum += output.tellp();
+  }));
+  Report("text_fast_format_uncertain_3d", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    sum += ToChars(buffer, buffer + sizeof(buffer), pose).ptr - buffer;
+  }));
+
+  tUncertainPose3D<> parsed;
+  Report("text_stream_parse_uncertain_3d", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    std::stringstream input(text);
+    input >> parsed;
+    sum += parsed.X().Value();
+  }));
+  Report("text_fast_parse_uncertain_3d", MeasureNanosecondsPerOperation(iterations, [&](size_t)
+  {
+    FromChars(text.data(), text.data() + text.size(), parsed);
+    sum += parsed.X().Value();
+  }));
+
+  // a bulk file of plain poses, parsed in one pass without creating a stream per record
+  const size_t cRECORDS = 100000;
+  std::stringstream records;
+  tPose3D<> sample;
+  for (size_t i = 0; i < cRECORDS; ++i)
+  {
+    SetSamplePose(sample, std::sin(i * 1E-3));
+    records << sample << std::endl;
+  }
+  const std::string bulk = records.str();
+  Report("text_stream_parse_bulk_3d", MeasureNanosecondsPerOperation(1, [&](size_t)
+  {
+    std::stringstream input(bulk);
+    while (input >> sample)
+    {
+      sum += sample.X().Value();
+    }
+  }) / cRECORDS);
+  Report("text_fast_parse_bulk_3d", MeasureNanosecondsPerOperation(1, [&](size_t)
+  {
+    const char *cursor = bulk.data();
+    const char *last = bulk.data() + bulk.size();
+    for (tFromCharsResult result = FromChars(cursor, last, sample); result.ec == std::errc(); result = FromChars(cursor, last, sample))
+    {
+      cursor = result.ptr;
+      sum += sample.X().Value();
+    }
+  }) / cRECORDS);
+  std::cerr << "  result " << sum << std::endl;
+}
+
+//! Lets one writer call store while reader_count threads keep calling load
+template <typename TStore, typename TLoad>
+void MeasureContention(const std::string &name, size_t iterations, size_t reader_count, TStore store, TLoad load)
+{
+  std::atomic<bool> done(false);
+  std::atomic<size_t> reads(0);
+  std::atomic<size_t> checksum(0);
+  std::vector<std::thread> readers;
+  for (size_t i = 0; i < reader_count; ++i)
+  {
+    readers.emplace_back([&]
+    {
+      size_t count = 0;
+      double sum = 0;
+      while (!done.load(std::memory_order_relaxed))
+      {
+        sum += load().X().Value();
+        ++count;
+      }
+      reads += count;
+      checksum += sum > 0;
+    });
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i)
+  {
+    store(i);
+  }
+  auto end = std::chrono::steady_clock::now();
+  done = true;
+  for (auto & reader : readers)
+  {
+    reader.join();
+  }
+
+  const double nanoseconds = std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(end - start).count();
+  Report(name + "_write_" + std::to_string(reader_count) + "_readers", nanoseconds / iterations);
+  Report(name + "_read_" + std::to_string(reader_count) + "_readers", nanoseconds * reader_count / std::max<size_t>(1, reads.load()));
+}
+
+void BenchmarkSharedPose(size_t iterations)
+{
+  typedef tUncertainPose3D<> tPose;
+  tPose pose;
+  pose.CovarianceXX() = 0.1;
+
+  for (size_t reader_count : { 1, 2, 4, 8 })
+  {
+    tSharedPose<tPose> shared_pose(pose);
+    MeasureContention("shared_pose_seqlock", iterations, reader_count, [&](size_t i)
+    {
+      pose.SetPosition(0.001 * i, 0, 0);
+      shared_pose.Store(pose);
+    }, [&]
+    {
+      return shared_pose.Load();
+    });
+
+    std::mutex mutex;
+    tPose locked_pose;
+    MeasureContention("shared_pose_mutex", iterations, reader_count, [&](size_t i)
+    {
+      pose.SetPosition(0.001 * i, 0, 0);
+      std::lock_guard<std::mutex> lock(mutex);
+      locked_pose = pose;
+    }, [&]
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      return locked_pose;
+    });
+  }
+}
+
+}
+
+//----------------------------------------------------------------------
+// main
+//----------------------------------------------------------------------
+int main(int argc, char **argv)
+{
+  size_t iterations = cDEFAULT_ITERATIONS;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string argument(argv[i]);
+    if (argument == "--format=text")
+    {
+      output_format = tOutputFormat::TEXT;
+    }
+    else if (argument == "--format=csv")
+    {
+      output_format = tOutputFormat::CSV;
+    }
+    else if (argument == "--format=json")
+    {
+      output_format = tOutputFormat::JSON;
+    }
+    else if (argument.find_first_not_of("0123456789") == std::string::npos)
+    {
+      iterations = std::strtoul(argument.c_str(), nullptr, 10);
+    }
+    else
+    {
+      std::cerr << "Usage: " << argv[0] << " [iterations] [--format=text|csv|json]" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (output_format == tOutputFormat::CSV)
+  {
+    std::cout << "name,ns_per_op" << std::endl;
+  }
+
+  BenchmarkCoreOperations<2, float>(iterations);
+  BenchmarkCoreOperations<2, double>(iterations);
+  BenchmarkCoreOperations<3, float>(iterations);
+  BenchmarkCoreOperations<3, double>(iterations);
+  BenchmarkCoreDeadReckoning<float>(iterations);
+  BenchmarkCoreDeadReckoning<double>(iterations);
+
+  BenchmarkComposition(iterations);
+  BenchmarkLocalFrame(iterations);
+  BenchmarkBatchTransformation(iterations);
+  BenchmarkEulerExtraction(iterations);
+  BenchmarkPoseWithCache(iterations);
+  BenchmarkInterpolation(iterations);
+  BenchmarkPoseArray(iterations);
+  BenchmarkSharedPose(iterations);
+  BenchmarkCovariancePropagation(iterations);
+  BenchmarkPackedCovariance(iterations);
+  BenchmarkFloatDeadReckoning();
+  BenchmarkDeadReckoningSubSteps(iterations);
+  BenchmarkDeadReckoningReplay(iterations);
+  BenchmarkOdometryIntegration(iterations);
+  BenchmarkCompactEncoding(iterations);
+  BenchmarkTrajectoryLog();
+  BenchmarkTrajectoryStore();
+  BenchmarkTextConversion(iterations);
+
+  return EXIT_SUCCESS;
+}
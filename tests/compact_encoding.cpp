@@ -0,0 +1,222 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tests/compact_encoding.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "rrlib/localization/tCompactEncoding.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestCompactEncoding : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestCompactEncoding);
+  RRLIB_UNIT_TESTS_ADD_TEST(Poses);
+  RRLIB_UNIT_TESTS_ADD_TEST(Twists);
+  RRLIB_UNIT_TESTS_ADD_TEST(Covariances);
+  RRLIB_UNIT_TESTS_ADD_TEST(Batch);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  void Poses()
+  {
+    const tCompactEncoding encoding;
+    uint8_t buffer[64];
+
+    const tPose2D<> pose_2d(1.2344, -5.6781, math::tAngleDeg(12.345));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(12), encoding.GetEncodedSize(pose_2d));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(12), encoding.Encode(pose_2d, buffer));
+    tPose2D<> decoded_2d;
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(12), encoding.Decode(buffer, decoded_2d));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(1.234, decoded_2d.X().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(-5.678, decoded_2d.Y().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(pose_2d.Yaw().Value().Value(), decoded_2d.Yaw().Value().Value(), 0.005 * M_PI / 180);
+
+    // little endian integers of the quantised values
+    RRLIB_UNIT_TESTS_EQUALITY(uint8_t(0xD2), buffer[0]);
+    RRLIB_UNIT_TESTS_EQUALITY(uint8_t(0x04), buffer[1]);
+    RRLIB_UNIT_TESTS_EQUALITY(uint8_t(0x00), buffer[2]);
+    RRLIB_UNIT_TESTS_EQUALITY(uint8_t(0x00), buffer[3]);
+
+    const tPose3D<float> pose_3d(1, 2, 3, math::tAngleDeg(10), math::tAngleDeg(-20), math::tAngleDeg(30));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(24), encoding.Encode(pose_3d, buffer));
+    tPose3D<float> decoded_3d;
+    encoding.Decode(buffer, decoded_3d);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose_3d, decoded_3d, 1E-4));
+
+    // coarser resolutions and saturation
+    const tCompactEncoding coarse(0.1, M_PI / 180);
+    coarse.Encode(tPose2D<>(1E12, 0.26, math::tAngleDeg(45.4)), buffer);
+    coarse.Decode(buffer, decoded_2d);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.1 * 2147483647, decoded_2d.X().Value(), 1E-3);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.3, decoded_2d.Y().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(45 * M_PI / 180, decoded_2d.Yaw().Value().Value(), 1E-9);
+    coarse.Encode(tPose2D<>(-1E12, 0, math::tAngleDeg(0)), buffer);
+    coarse.Decode(buffer, decoded_2d);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(-0.1 * 2147483647, decoded_2d.X().Value(), 1E-3);
+
+    // NaN is not saturated but arrives as NaN
+    coarse.Encode(tPose2D<>(std::numeric_limits<double>::quiet_NaN(), 1, math::tAngleDeg(0)), buffer);
+    coarse.Decode(buffer, decoded_2d);
+    RRLIB_UNIT_TESTS_ASSERT(std::isnan(decoded_2d.X().Value()));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(1, decoded_2d.Y().Value(), 1E-9);
+  }
+
+  void Twists()
+  {
+    const tCompactEncoding encoding;
+    uint8_t buffer[64];
+
+    tTwist3D<> twist;
+    twist.SetPosition(1.5, -0.25, 0);
+    twist.SetOrientation(tTwist3D<>::tOrientationComponent<>(0), tTwist3D<>::tOrientationComponent<>(0.1), tTwist3D<>::tOrientationComponent<>(-0.5));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(24), encoding.Encode(twist, buffer));
+    tTwist3D<> decoded;
+    encoding.Decode(buffer, decoded);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(1.5, decoded.X().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(-0.25, decoded.Y().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.1, decoded.Pitch().Value().Value(), 1E-4);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(-0.5, decoded.Yaw().Value().Value(), 1E-4);
+  }
+
+  void Covariances()
+  {
+    uint8_t buffer[128];
+    math::tMatrix<6, 6, double> covariance;
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        covariance[i][j] = i == j ? 0.1 * (i + 1) : 0.001 * (i + j);
+      }
+    }
+    const tUncertainPose3D<> pose(1, 2, 3, math::tAngleDeg(10), math::tAngleDeg(-20), math::tAngleDeg(30), covariance);
+
+    const tCompactEncoding encoding;
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(24 + 21 * 4), encoding.GetEncodedSize(pose));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(24 + 21 * 4), encoding.Encode(pose, buffer));
+    tUncertainPose3D<> decoded;
+    encoding.Decode(buffer, decoded);
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(covariance[i][j], decoded.Covariance()[i][j], 1E-7);
+      }
+    }
+
+    // packed poses are read and written without unpacking
+    tPackedUncertainPose3D<> packed;
+    encoding.Decode(buffer, packed);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(covariance[1][5], packed.CovarianceYYaw(), 1E-7);
+    uint8_t packed_buffer[128];
+    RRLIB_UNIT_TESTS_EQUALITY(encoding.GetEncodedSize(pose), encoding.Encode(packed, packed_buffer));
+    RRLIB_UNIT_TESTS_ASSERT(std::equal(buffer, buffer + encoding.GetEncodedSize(pose), packed_buffer));
+
+    // without covariances the one of a reused target is cleared
+    const tCompactEncoding mean_only(1E-3, 0.01 * M_PI / 180, tCompactEncoding::tCovarianceMode::NONE);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(24), mean_only.Encode(pose, buffer));
+    tUncertainPose3D<> target;
+    target.CovarianceXX() = 7;
+    mean_only.Decode(buffer, target);
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, target.CovarianceXX());
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(2, target.Y().Value(), 1E-9);
+    mean_only.Decode(buffer, packed);
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, packed.CovarianceYYaw());
+  }
+
+  void Batch()
+  {
+    const tCompactEncoding encoding;
+    std::vector<uint8_t> buffer;
+    for (size_t i = 0; i < 10; ++i)
+    {
+      const tUncertainPose2D<> pose(0.1 * i, -0.2 * i, math::tAngleDeg(i), math::tMatrix<3, 3, double>(0.1, 0, 0, 0, 0.1, 0, 0, 0, 0.01 * i));
+      const size_t offset = buffer.size();
+      buffer.resize(offset + encoding.GetEncodedSize(pose));
+      encoding.Encode(pose, buffer.data() + offset);
+    }
+
+    std::vector<tUncertainPose2D<>> poses(10);
+    RRLIB_UNIT_TESTS_EQUALITY(buffer.size(), encoding.Decode(buffer.data(), poses.size(), poses.data()));
+    for (size_t i = 0; i < 10; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(-0.2 * i, poses[i].Y().Value(), 1E-9);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.01 * i, poses[i].VarianceYaw(), 1E-7);
+    }
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestCompactEncoding);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
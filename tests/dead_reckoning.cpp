@@ -33,6 +33,12 @@
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "rrlib/localization/tDeadReckoning.h"
 
 //----------------------------------------------------------------------
@@ -97,6 +103,11 @@ class TestDeadReckoning : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(TestAngular);
   RRLIB_UNIT_TESTS_ADD_TEST(TestCombined);
   RRLIB_UNIT_TESTS_ADD_TEST(TestCombinedInstance);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestCovariance);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestPublishedPose);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestFloat);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestIntegrationMethods);
+  RRLIB_UNIT_TESTS_ADD_TEST(TestTimestamped);
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -342,6 +353,302 @@ private:
 
   }
 
+  void TestCovariance()
+  {
+    typedef tUncertainPose3D<> tPose;
+    typedef tUncertainTwist3D<> tTwist;
+
+    tTwist t;
+    t.SetPosition(1, 0, 0);
+
+    // without any uncertainty nothing is added
+    tPose p;
+    tDeadReckoning::UpdatePose(p, t, std::chrono::milliseconds(1000));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Covariance must stay zero", tPose::tCovarianceMatrix<>(), p.Covariance());
+
+    // an uncertain heading turns into lateral uncertainty when driving straight ahead for 1 m
+    p = tPose();
+    p.CovarianceYawYaw() = 0.01;
+    tDeadReckoning::UpdatePose(p, t, std::chrono::milliseconds(1000));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Lateral variance must be correct", 0.01, p.CovarianceYY(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Lateral and heading covariance must be correct", 0.01, p.CovarianceYYaw(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Heading variance must be kept", 0.01, p.CovarianceYawYaw(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Longitudinal variance must stay zero", 0, p.CovarianceXX(), 1E-9);
+
+    // an uncertain velocity is integrated with the squared elapsed time
+    p = tPose();
+    t.CovarianceXX() = 0.04;
+    tDeadReckoning::UpdatePose(p, t, std::chrono::milliseconds(2000));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Longitudinal variance must be correct", 0.16, p.CovarianceXX(), 1E-9);
+
+    // the variance grows with every update of an instance
+    tDeadReckoning obj;
+    obj.UpdatePose(t, std::chrono::milliseconds(1000));
+    const double variance = obj.GetPose().CovarianceXX();
+    obj.UpdatePose(t, std::chrono::milliseconds(1000));
+    RRLIB_UNIT_TESTS_ASSERT(obj.GetPose().CovarianceXX() > variance);
+  }
+
+  void TestPublishedPose()
+  {
+    typedef tUncertainPose3D<> tPose;
+
+    tDeadReckoning obj;
+    obj.SetPublishPose(true);
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Initial pose must be published", obj.GetPose(), obj.GetPublishedPose());
+
+    // the writer only sets poses whose components and variances are all the same, so readers can detect torn copies
+    const size_t cUPDATES = 100000;
+    std::atomic<bool> done(false);
+    std::atomic<size_t> torn_reads(0);
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < 4; ++i)
+    {
+      readers.emplace_back([&obj, &done, &torn_reads]
+      {
+        while (!done.load())
+        {
+          const tPose pose = obj.GetPublishedPose();
+          const double value = pose.X().Value();
+          if (pose.Y().Value() != value || pose.Z().Value() != value || pose.CovarianceXX() != value || pose.CovarianceYawYaw() != value)
+          {
+            ++torn_reads;
+          }
+        }
+      });
+    }
+
+    for (size_t i = 1; i <= cUPDATES; ++i)
+    {
+      tPose pose;
+      pose.SetPosition(i, i, i);
+      pose.CovarianceXX() = i;
+      pose.CovarianceYawYaw() = i;
+      obj.SetPose(pose);
+    }
+    done = true;
+    for (auto & reader : readers)
+    {
+      reader.join();
+    }
+
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Readers must never see partially written poses", size_t(0), torn_reads.load());
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Latest pose must be published", obj.GetPose(), obj.GetPublishedPose());
+  }
+
+  void TestFloat()
+  {
+    // drive a circle for 10 s with values that are exact in float
+    tDeadReckoning reference;
+    tGenericDeadReckoning<float> single;
+    tGenericDeadReckoning<float, double> accumulated;
+    accumulated.SetPublishPose(true);
+    tUncertainTwist3D<> twist;
+    twist.SetPosition(1, 0, 0);
+    twist.SetOrientation(tUncertainTwist3D<>::tOrientationComponent<>(0), tUncertainTwist3D<>::tOrientationComponent<>(0), tUncertainTwist3D<>::tOrientationComponent<>(0.125));
+    tUncertainTwist3D<float> twist_float;
+    twist_float.SetPosition(1, 0, 0);
+    twist_float.SetOrientation(tUncertainTwist3D<float>::tOrientationComponent<>(0), tUncertainTwist3D<float>::tOrientationComponent<>(0), tUncertainTwist3D<float>::tOrientationComponent<>(0.125));
+    for (size_t i = 0; i < 1000; ++i)
+    {
+      reference.UpdatePose(twist, std::chrono::milliseconds(10));
+      single.UpdatePose(twist_float, std::chrono::milliseconds(10));
+      accumulated.UpdatePose(twist_float, std::chrono::milliseconds(10));
+    }
+
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Float must be close to double", reference.GetPose().X().Value(), single.GetPose().X().Value(), 1E-4);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Float must be close to double", reference.GetPose().Y().Value(), single.GetPose().Y().Value(), 1E-4);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Accumulating in double must match double", reference.GetPose().X().Value(), accumulated.GetPose().X().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Accumulating in double must match double", reference.GetPose().Y().Value(), accumulated.GetPose().Y().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Accumulating in double must match double", reference.GetPose().Yaw().Value().Value(), accumulated.GetPose().Yaw().Value().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Published pose must be rounded to float", accumulated.GetPose().X().Value(), accumulated.GetPublishedPose().X().Value(), 1E-6);
+
+    // particles with their own twists move like single poses
+    const size_t cPARTICLES = 17;
+    tGenericDeadReckoning<float>::tPoseArray particles(cPARTICLES);
+    tGenericDeadReckoning<float>::tTwistArray twists(cPARTICLES);
+    for (size_t i = 0; i < cPARTICLES; ++i)
+    {
+      particles.X()[i] = i;
+      twists.X()[i] = 1;
+      twists.Y()[i] = 0.01f * i;
+      twists.Yaw()[i] = 0.1f * i;
+    }
+    tGenericDeadReckoning<float>::tPoseArray relative_transformations;
+    tGenericDeadReckoning<float>::UpdatePoses(particles, twists, std::chrono::milliseconds(100), relative_transformations);
+    for (size_t i = 0; i < cPARTICLES; ++i)
+    {
+      tUncertainPose3D<float> pose;
+      pose.SetPosition(i, 0, 0);
+      tUncertainTwist3D<float> particle_twist;
+      particle_twist.SetPosition(1, 0.01f * i, 0);
+      particle_twist.SetOrientation(tUncertainTwist3D<float>::tOrientationComponent<>(0), tUncertainTwist3D<float>::tOrientationComponent<>(0), tUncertainTwist3D<float>::tOrientationComponent<>(0.1f * i));
+      tGenericDeadReckoning<float>::UpdatePose(pose, particle_twist, std::chrono::milliseconds(100));
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Particle must be updated", pose.X().Value(), particles.X()[i], 1E-5);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Particle must be updated", pose.Y().Value(), particles.Y()[i], 1E-5);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Particle must be updated", pose.Yaw().Value().Value(), particles.Yaw()[i], 1E-5);
+    }
+  }
+
+  void TestIntegrationMethods()
+  {
+    typedef tUncertainPose3D<> tPose;
+    typedef tUncertainTwist3D<> tTwist;
+    typedef tDeadReckoning::tMeanTwist tMeanTwist;
+
+    // one update of 1 s on a circle with radius 1 m ends at (sin(1), 1 - cos(1)), also if it is a single step
+    tTwist twist;
+    twist.SetPosition(1, 0, 0);
+    twist.SetOrientation(tTwist::tOrientationComponent<>(0), tTwist::tOrientationComponent<>(0), tTwist::tOrientationComponent<>(1));
+    for (auto method : { tDeadReckoning::eDRIM_SUB_STEPS, tDeadReckoning::eDRIM_RUNGE_KUTTA })
+    {
+      for (auto maximum_step : { rrlib::time::tDuration(std::chrono::milliseconds(10)), rrlib::time::tDuration(std::chrono::seconds(1)) })
+      {
+        tPose pose;
+        tDeadReckoning::UpdatePose(pose, twist, std::chrono::seconds(1), method, maximum_step);
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Long interval must follow the arc", std::sin(1.0), pose.X().Value(), 1E-9);
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Long interval must follow the arc", 1 - std::cos(1.0), pose.Y().Value(), 1E-9);
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Long interval must follow the arc", 1, pose.Yaw().Value().Value(), 1E-9);
+      }
+    }
+
+    // a single large step with a constant 3D twist stays on the helix of the exponential map
+    tTwist helix_twist;
+    helix_twist.SetPosition(0.5, 0.1, 0.2);
+    helix_twist.SetOrientation(tTwist::tOrientationComponent<>(0.3), tTwist::tOrientationComponent<>(-0.2), tTwist::tOrientationComponent<>(1.2));
+    tMeanTwist mean_helix_twist;
+    mean_helix_twist.SetPosition(0.5, 0.1, 0.2);
+    mean_helix_twist.SetOrientation(tMeanTwist::tOrientationComponent<>(0.3), tMeanTwist::tOrientationComponent<>(-0.2), tMeanTwist::tOrientationComponent<>(1.2));
+    tDeadReckoning::tMeanPose helix;
+    tDeadReckoning::UpdateMean(helix, mean_helix_twist, std::chrono::seconds(1));
+    for (auto method : { tDeadReckoning::eDRIM_SUB_STEPS, tDeadReckoning::eDRIM_RUNGE_KUTTA })
+    {
+      tPose pose;
+      tDeadReckoning::UpdatePose(pose, helix_twist, std::chrono::seconds(1), method, std::chrono::seconds(1));
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Large step must follow the helix", helix.X().Value(), pose.X().Value(), 1E-9);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Large step must follow the helix", helix.Y().Value(), pose.Y().Value(), 1E-9);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Large step must follow the helix", helix.Z().Value(), pose.Z().Value(), 1E-9);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Large step must follow the helix", helix.Roll().Value().Value(), pose.Roll().Value().Value(), 1E-9);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Large step must follow the helix", helix.Pitch().Value().Value(), pose.Pitch().Value().Value(), 1E-9);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Large step must follow the helix", helix.Yaw().Value().Value(), pose.Yaw().Value().Value(), 1E-9);
+    }
+
+    // rotating about a single axis, all methods read the orientation part of the twist the same way
+    for (auto method : { tDeadReckoning::eDRIM_TRAPEZOID, tDeadReckoning::eDRIM_SUB_STEPS, tDeadReckoning::eDRIM_RUNGE_KUTTA })
+    {
+      tPose pose;
+      tDeadReckoning::UpdatePose(pose, twist, std::chrono::milliseconds(500), method, std::chrono::milliseconds(10));
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Methods must agree on the meaning of the twist", 0.5, pose.Yaw().Value().Value(), 1E-9);
+    }
+
+    // the covariance is propagated over the whole interval like with the trapezoidal update
+    twist.Covariance()[0][0] = 0.01;
+    tPose trapezoid_pose;
+    tPose sub_steps_pose;
+    tDeadReckoning::UpdatePose(trapezoid_pose, twist, std::chrono::milliseconds(100));
+    tDeadReckoning::UpdatePose(sub_steps_pose, twist, std::chrono::milliseconds(100), tDeadReckoning::eDRIM_SUB_STEPS, std::chrono::milliseconds(10));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Covariance must not depend on the steps", trapezoid_pose.Covariance()[0][0], sub_steps_pose.Covariance()[0][0], 1E-9);
+
+    // a linearly changing 3D twist in one update must match many short updates
+    tTwist previous_twist;
+    previous_twist.SetPosition(0.5, 0.1, 0.2);
+    previous_twist.SetOrientation(tTwist::tOrientationComponent<>(0.3), tTwist::tOrientationComponent<>(-0.2), tTwist::tOrientationComponent<>(0.1));
+    twist.SetPosition(1.5, -0.1, 0);
+    twist.SetOrientation(tTwist::tOrientationComponent<>(0.5), tTwist::tOrientationComponent<>(0.3), tTwist::tOrientationComponent<>(1.2));
+    tDeadReckoning reference;
+    reference.SetIntegrationMethod(tDeadReckoning::eDRIM_RUNGE_KUTTA, std::chrono::milliseconds(1));
+    reference.UpdatePose(previous_twist, std::chrono::seconds(0));
+    reference.UpdatePose(twist, std::chrono::seconds(1));
+    for (auto method : { tDeadReckoning::eDRIM_SUB_STEPS, tDeadReckoning::eDRIM_RUNGE_KUTTA })
+    {
+      tDeadReckoning obj;
+      obj.SetIntegrationMethod(method);
+      obj.UpdatePose(previous_twist, std::chrono::seconds(0));
+      obj.UpdatePose(twist, std::chrono::seconds(1));
+      const double tolerance = method == tDeadReckoning::eDRIM_SUB_STEPS ? 1E-4 : 1E-8;
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Steps must converge", reference.GetPose().X().Value(), obj.GetPose().X().Value(), tolerance);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Steps must converge", reference.GetPose().Y().Value(), obj.GetPose().Y().Value(), tolerance);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Steps must converge", reference.GetPose().Z().Value(), obj.GetPose().Z().Value(), tolerance);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Steps must converge", reference.GetPose().Roll().Value().Value(), obj.GetPose().Roll().Value().Value(), tolerance);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Steps must converge", reference.GetPose().Pitch().Value().Value(), obj.GetPose().Pitch().Value().Value(), tolerance);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Steps must converge", reference.GetPose().Yaw().Value().Value(), obj.GetPose().Yaw().Value().Value(), tolerance);
+    }
+  }
+
+  void TestTimestamped()
+  {
+    typedef tUncertainTwist3D<> tTwist;
+
+    // twists every 10 ms on a wavy path with some uncertainty
+    const size_t cCOUNT = 30;
+    const time::tTimestamp start;
+    std::vector<tTwist> twists(cCOUNT);
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      twists[i].SetPosition(1 + 0.1 * i, 0.01 * i, 0);
+      twists[i].SetOrientation(tTwist::tOrientationComponent<>(0.01 * i), tTwist::tOrientationComponent<>(0), tTwist::tOrientationComponent<>(std::sin(0.3 * i)));
+      twists[i].Covariance()[0][0] = 0.01;
+      twists[i].Covariance()[5][5] = 0.001;
+    }
+    auto timestamp = [&start](size_t i)
+    {
+      return start + std::chrono::milliseconds(10 * i);
+    };
+
+    // in order this is the same as the updates with elapsed time
+    tDeadReckoning reference;
+    tDeadReckoning in_order;
+    reference.UpdatePose(twists[0], std::chrono::milliseconds(0));
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      if (i > 0)
+      {
+        reference.UpdatePose(twists[i], std::chrono::milliseconds(10));
+      }
+      RRLIB_UNIT_TESTS_ASSERT(in_order.UpdatePose(twists[i], timestamp(i)));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("In order must match elapsed time", reference.GetPose().X().Value(), in_order.GetPose().X().Value(), 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("In order must match elapsed time", reference.GetPose().Y().Value(), in_order.GetPose().Y().Value(), 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("In order must match elapsed time", reference.GetPose().Yaw().Value().Value(), in_order.GetPose().Yaw().Value().Value(), 1E-12);
+
+    // swapped neighbours, a twist delayed by five periods and a duplicate must give the same pose
+    std::vector<size_t> order;
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      order.push_back(i);
+    }
+    std::swap(order[3], order[4]);
+    std::swap(order[10], order[11]);
+    order.erase(order.begin() + 15);
+    order.insert(order.begin() + 20, 15);
+    order.insert(order.begin() + 25, 22);
+    tDeadReckoning out_of_order;
+    out_of_order.SetPublishPose(true);
+    for (size_t i : order)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(out_of_order.UpdatePose(twists[i], timestamp(i)));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Out of order must match in order", in_order.GetPose().X().Value(), out_of_order.GetPose().X().Value(), 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Out of order must match in order", in_order.GetPose().Y().Value(), out_of_order.GetPose().Y().Value(), 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Out of order must match in order", in_order.GetPose().Roll().Value().Value(), out_of_order.GetPose().Roll().Value().Value(), 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Out of order must match in order", in_order.GetPose().Yaw().Value().Value(), out_of_order.GetPose().Yaw().Value().Value(), 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Out of order must match in order", in_order.GetPose().Covariance()[1][1], out_of_order.GetPose().Covariance()[1][1], 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE_MESSAGE("Out of order must match in order", in_order.GetPose().X().Value(), out_of_order.GetPublishedPose().X().Value(), 1E-12);
+
+    // twists older than the history are rejected and do not change the pose
+    tDeadReckoning bounded;
+    bounded.SetHistoryCapacity(5);
+    for (size_t i = 10; i < cCOUNT; ++i)
+    {
+      bounded.UpdatePose(twists[i], timestamp(i));
+    }
+    const double x = bounded.GetPose().X().Value();
+    RRLIB_UNIT_TESTS_ASSERT(!bounded.UpdatePose(twists[0], timestamp(0)));
+    RRLIB_UNIT_TESTS_EQUALITY_MESSAGE("Rejected twist must not change the pose", x, bounded.GetPose().X().Value());
+    RRLIB_UNIT_TESTS_ASSERT(bounded.UpdatePose(twists[0], timestamp(cCOUNT - 2)));
+    RRLIB_UNIT_TESTS_ASSERT(x != bounded.GetPose().X().Value());
+  }
+
 };
 
 RRLIB_UNIT_TESTS_REGISTER_SUITE(TestDeadReckoning);
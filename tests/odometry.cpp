@@ -0,0 +1,234 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tests/odometry.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <cmath>
+
+#include "rrlib/localization/tOdometry.h"
+#include "rrlib/localization/tVehicleOdometry.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestOdometry : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestOdometry);
+  RRLIB_UNIT_TESTS_ADD_TEST(PlanarFastPath);
+  RRLIB_UNIT_TESTS_ADD_TEST(NonPlanarPose);
+  RRLIB_UNIT_TESTS_ADD_TEST(IntegrationMethods);
+  RRLIB_UNIT_TESTS_ADD_TEST(VehicleOdometry);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  static double AngleDifference(double left, double right)
+  {
+    return math::tAngleRad(left - right).Value();
+  }
+
+  void AssertEqual(const math::tPose3D &expected, const math::tPose3D &actual, double tolerance)
+  {
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(expected.X(), actual.X(), tolerance);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(expected.Y(), actual.Y(), tolerance);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(expected.Z(), actual.Z(), tolerance);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.0, AngleDifference(math::tAngleRad(expected.Roll()).Value(), math::tAngleRad(actual.Roll()).Value()), tolerance);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.0, AngleDifference(math::tAngleRad(expected.Pitch()).Value(), math::tAngleRad(actual.Pitch()).Value()), tolerance);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.0, AngleDifference(math::tAngleRad(expected.Yaw()).Value(), math::tAngleRad(actual.Yaw()).Value()), tolerance);
+  }
+
+  //! Drives both odometries through the same sequence of curves, straight lines and side slip
+  void Drive(tOdometry &reference, tOdometry &odometry)
+  {
+    for (size_t i = 0; i < 2000; ++i)
+    {
+      const util::tTime time(i / 100, (i % 100) * 10000);
+      reference.UpdateTime(time, time);
+      odometry.UpdateTime(time, time);
+
+      const double velocity = 1.5 + std::sin(i * 0.01);
+      const double angular_velocity = (i % 400) < 100 ? 0.0 : 1.2 * std::cos(i * 0.003);
+      const double side_slip_angle = (i % 300) < 150 ? 0.0 : 0.05 * std::sin(i * 0.02);
+      RRLIB_UNIT_TESTS_ASSERT(reference.UpdatePose(velocity, angular_velocity, side_slip_angle));
+      RRLIB_UNIT_TESTS_ASSERT(odometry.UpdatePose(velocity, angular_velocity, side_slip_angle));
+
+      AssertEqual(reference.CurrentPoseWcs(), odometry.CurrentPoseWcs(), 1E-9);
+      AssertEqual(reference.VelocityVectorWcs(), odometry.VelocityVectorWcs(), 1E-9);
+      AssertEqual(reference.AngularVelocityVectorWcs(), odometry.AngularVelocityVectorWcs(), 1E-6);
+    }
+  }
+
+  void PlanarFastPath()
+  {
+    math::tPose3D initial_pose = math::tPose3D::Zero();
+    initial_pose.Set(1., -2., 0.5);
+    initial_pose.SetOrientation(math::tAngleRad(0.0), math::tAngleRad(0.0), math::tAngleRad(3.0));
+
+    tOdometry reference(false, initial_pose);
+    reference.SetUsePlanarFastPath(false);
+    tOdometry odometry(false, initial_pose);
+    RRLIB_UNIT_TESTS_ASSERT(odometry.UsePlanarFastPath());
+
+    Drive(reference, odometry);
+    RRLIB_UNIT_TESTS_EQUALITY(reference.DataChanged(), odometry.DataChanged());
+  }
+
+  void NonPlanarPose()
+  {
+    // poses with roll or pitch still use the general path
+    math::tPose3D initial_pose = math::tPose3D::Zero();
+    initial_pose.SetOrientation(math::tAngleRad(0.1), math::tAngleRad(-0.2), math::tAngleRad(0.3));
+
+    tOdometry reference(false, initial_pose);
+    reference.SetUsePlanarFastPath(false);
+    tOdometry odometry(false, initial_pose);
+
+    Drive(reference, odometry);
+    RRLIB_UNIT_TESTS_ASSERT(math::tAngleRad(odometry.CurrentPoseWcs().Roll()).Value() != 0);
+  }
+
+  //! Drives for 10 s with linearly increasing velocities, updated with the given frequency
+  math::tPose3D Integrate(tOdometry::tIntegrationMethod method, unsigned int frequency, double acceleration)
+  {
+    tOdometry odometry(false);
+    odometry.SetIntegrationMethod(method);
+    for (unsigned int i = 0; i <= 10 * frequency; ++i)
+    {
+      const double t = static_cast<double>(i) / frequency;
+      const util::tTime time(i / frequency, (i % frequency) * (1000000 / frequency));
+      odometry.UpdateTime(time, time);
+      odometry.UpdatePose(1 + acceleration * t, 0.3 + 0.2 * acceleration * t, 0.);
+    }
+    return odometry.CurrentPoseWcs();
+  }
+
+  static double PositionError(const math::tPose3D &expected, const math::tPose3D &actual)
+  {
+    return std::hypot(expected.X() - actual.X(), expected.Y() - actual.Y());
+  }
+
+  void IntegrationMethods()
+  {
+    // with constant velocities the arc is exact and the other methods agree
+    const math::tPose3D arc = Integrate(tOdometry::eOIM_EXACT_ARC, 10, 0);
+    RRLIB_UNIT_TESTS_ASSERT(PositionError(arc, Integrate(tOdometry::eOIM_TRAPEZOID, 10, 0)) < 1E-9);
+    RRLIB_UNIT_TESTS_ASSERT(PositionError(arc, Integrate(tOdometry::eOIM_RUNGE_KUTTA, 10, 0)) < 1E-6);
+    RRLIB_UNIT_TESTS_ASSERT(PositionError(arc, Integrate(tOdometry::eOIM_MIDPOINT, 10, 0)) < 1E-3);
+
+    // with changing velocities only the current ones are wrong for the whole interval
+    const math::tPose3D reference = Integrate(tOdometry::eOIM_RUNGE_KUTTA, 1000, 0.5);
+    RRLIB_UNIT_TESTS_ASSERT(PositionError(reference, Integrate(tOdometry::eOIM_EXACT_ARC, 10, 0.5)) > 0.1);
+    RRLIB_UNIT_TESTS_ASSERT(PositionError(reference, Integrate(tOdometry::eOIM_TRAPEZOID, 10, 0.5)) < 1E-3);
+    RRLIB_UNIT_TESTS_ASSERT(PositionError(reference, Integrate(tOdometry::eOIM_MIDPOINT, 10, 0.5)) < 1E-2);
+    RRLIB_UNIT_TESTS_ASSERT(PositionError(reference, Integrate(tOdometry::eOIM_RUNGE_KUTTA, 10, 0.5)) < 1E-5);
+  }
+
+  void VehicleOdometry()
+  {
+    // with constant side slip the mean twist is the twist of the mean velocities
+    tOdometry reference(false);
+    reference.SetIntegrationMethod(tOdometry::eOIM_TRAPEZOID);
+    tVehicleOdometry<> odometry;
+    const time::tTimestamp start;
+    for (unsigned int i = 0; i <= 1000; ++i)
+    {
+      const double velocity = 1 + 0.5 * std::sin(i * 0.01);
+      const double angular_velocity = 0.8 * std::cos(i * 0.004);
+      const util::tTime time(i / 100, (i % 100) * 10000);
+      reference.UpdateTime(time, time);
+      reference.UpdatePose(velocity, angular_velocity, 0.1);
+      RRLIB_UNIT_TESTS_EQUALITY(i > 0, odometry.UpdatePose(velocity, angular_velocity, 0.1, start + std::chrono::milliseconds(10 * i)));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(reference.CurrentPoseWcs().X(), odometry.GetPose().X().Value(), 1E-6);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(reference.CurrentPoseWcs().Y(), odometry.GetPose().Y().Value(), 1E-6);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.0, AngleDifference(math::tAngleRad(reference.CurrentPoseWcs().Yaw()).Value(), odometry.GetPose().Yaw().Value().Value()), 1E-6);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.8 * std::cos(4.0), odometry.GetTwist().Yaw().Value().Value(), 1E-12);
+
+    // older timestamps are ignored, a reset restarts the timing
+    const tPose3D<> pose = odometry.GetPose();
+    RRLIB_UNIT_TESTS_ASSERT(!odometry.UpdatePose(1, 0, 0, start));
+    RRLIB_UNIT_TESTS_EQUALITY(pose, odometry.GetPose());
+    odometry.ResetTwist();
+    RRLIB_UNIT_TESTS_ASSERT(!odometry.UpdatePose(1, 0, 0, start));
+    RRLIB_UNIT_TESTS_ASSERT(odometry.UpdatePose(1, 0, 0, start + std::chrono::seconds(2)));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(pose.X().Value() + 2 * std::cos(pose.Yaw().Value().Value()), odometry.GetPose().X().Value(), 1E-9);
+
+    // updates with a duration: the first one follows the arc of the current twist, the next ones that of the mean twist
+    tVehicleOdometry<float> odometry_float;
+    odometry_float.UpdatePose(1.f, 0.5f, 0.f, std::chrono::seconds(1));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(std::sin(0.5) / 0.5, odometry_float.GetPose().X().Value(), 1E-5);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE((1 - std::cos(0.5)) / 0.5, odometry_float.GetPose().Y().Value(), 1E-5);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.5, odometry_float.GetPose().Yaw().Value().Value(), 1E-5);
+    odometry_float.UpdatePose(1.f, -0.5f, 0.f, std::chrono::seconds(1));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(std::sin(0.5) / 0.5 + std::cos(0.5), odometry_float.GetPose().X().Value(), 1E-5);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.5, odometry_float.GetPose().Yaw().Value().Value(), 1E-5);
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestOdometry);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
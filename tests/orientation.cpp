@@ -33,7 +33,9 @@
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 
+#include <cmath>
 #include <cstring>
+#include <stdexcept>
 
 #include "rrlib/localization/tOrientation.h"
 
@@ -81,6 +83,8 @@ class TestOrientation : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(ArithmeticOperators);
   RRLIB_UNIT_TESTS_ADD_TEST(Streaming);
   RRLIB_UNIT_TESTS_ADD_TEST(UnitChanges);
+  RRLIB_UNIT_TESTS_ADD_TEST(Quaternion);
+  RRLIB_UNIT_TESTS_ADD_TEST(EulerExtraction);
   RRLIB_UNIT_TESTS_END_SUITE;
 
 private:
@@ -357,6 +361,111 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY(orientation_change_3d, si_units::tTime<float>(10) * acceleration_3d);
     RRLIB_UNIT_TESTS_ASSERT(IsEqual(acceleration_3d, orientation_change_3d / si_units::tTime<float>(10), 0));
   }
+  void Quaternion()
+  {
+    typedef math::tAngle<double, math::angle::Degree> tAngle;
+    RRLIB_UNIT_TESTS_EQUALITY(4 * sizeof(double), sizeof(tQuaternionOrientation<double>));
+
+    tQuaternionOrientation<double> identity;
+    RRLIB_UNIT_TESTS_EQUALITY(1.0, identity.W());
+    RRLIB_UNIT_TESTS_ASSERT(tOrientation3D<double>(identity).IsZero());
+
+    tOrientation3D<double> euler(tAngle(10), tAngle(-40), tAngle(120));
+    tQuaternionOrientation<double> quaternion(euler);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(euler, tOrientation3D<double>(quaternion), 1E-12));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(euler.Pitch().Value().Value(), quaternion.Pitch().Value().Value(), 1E-12);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(quaternion, tQuaternionOrientation<double>(euler.GetMatrix()), 1E-12));
+
+    tOrientation3D<double> other(tAngle(-70), tAngle(20), tAngle(95));
+    tOrientation3D<double> expected(euler.GetMatrix() * other.GetMatrix());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, tOrientation3D<double>(quaternion * tQuaternionOrientation<double>(other)), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(euler.Rotated(other.GetMatrix()), tOrientation3D<double>(quaternion.Rotated(tQuaternionOrientation<double>(other))), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(identity, quaternion * quaternion.Inverted(), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(quaternion, tQuaternionOrientation<double>(-quaternion.W(), -quaternion.X(), -quaternion.Y(), -quaternion.Z())));
+
+    double vector[3] = { 1, 2, 3 };
+    quaternion.TransformVector(vector);
+    math::tVector<3, double> expected_vector = euler.GetMatrix() * math::tVector<3, double>(1, 2, 3);
+    for (size_t i = 0; i < 3; ++i)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(expected_vector[i], vector[i], 1E-12);
+    }
+
+    tQuaternionOrientation<float> chain;
+    const tQuaternionOrientation<float> step(tOrientation3D<double>(tAngle(0.3), tAngle(-0.7), tAngle(1.1)));
+    for (size_t i = 0; i < 100000; ++i)
+    {
+      chain *= step;
+    }
+    const float norm = std::sqrt(chain.W() * chain.W() + chain.X() * chain.X() + chain.Y() * chain.Y() + chain.Z() * chain.Z());
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(1.0, norm, 1E-6);
+  }
+
+  void EulerExtraction()
+  {
+    typedef math::tAngle<double, math::angle::Degree> tAngle;
+
+    tOrientation3D<double> euler(tAngle(10), tAngle(-40), tAngle(120));
+    tOrientation3D<double> extracted;
+    extracted.Set(euler.GetMatrix());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(euler, extracted, 1E-12));
+
+    // in gimbal lock roll is zero and yaw takes the whole rotation about the vertical axis
+    extracted.Set(tOrientation3D<double>(tAngle(30), tAngle(90), tAngle(50)).GetMatrix());
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0, extracted.Roll().Value().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(M_PI_2, extracted.Pitch().Value().Value(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(20 * M_PI / 180, extracted.Yaw().Value().Value(), 1E-9);
+
+    // matrices that are not orthonormal within max_error take the generic path like before
+    const math::tMatrix<3, 3, double> scaled = euler.GetMatrix() * 1.1;
+    bool generic_failed = false;
+    math::tAngle<double, math::angle::Radian> generic_roll, generic_pitch, generic_yaw;
+    try
+    {
+      scaled.ExtractRollPitchYaw(generic_roll, generic_pitch, generic_yaw, false, 1E-6);
+    }
+    catch (const std::exception &)
+    {
+      generic_failed = true;
+    }
+    bool set_failed = false;
+    try
+    {
+      extracted.Set(scaled);
+    }
+    catch (const std::exception &)
+    {
+      set_failed = true;
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(generic_failed, set_failed);
+    if (!generic_failed)
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(generic_roll.Value(), extracted.Roll().Value().Value(), 1E-12);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(generic_pitch.Value(), extracted.Pitch().Value().Value(), 1E-12);
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(generic_yaw.Value(), extracted.Yaw().Value().Value(), 1E-12);
+    }
+
+    const size_t cCOUNT = 7;
+    double rotations[cCOUNT][3][3];
+    double roll[cCOUNT], pitch[cCOUNT], yaw[cCOUNT];
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      orientation::GetRotationMatrix(rotations[i], 0.3 * i, i == 3 ? -M_PI_2 : 0.2 * i - 0.6, -0.5 * i);
+    }
+    orientation::ExtractRollPitchYaw(rotations, cCOUNT, roll, pitch, yaw);
+    for (size_t i = 0; i < cCOUNT; ++i)
+    {
+      double rotation[3][3];
+      orientation::GetRotationMatrix(rotation, roll[i], pitch[i], yaw[i]);
+      for (size_t j = 0; j < 3; ++j)
+      {
+        for (size_t k = 0; k < 3; ++k)
+        {
+          RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(rotations[i][j][k], rotation[j][k], 1E-9);
+        }
+      }
+    }
+  }
 };
 
 RRLIB_UNIT_TESTS_REGISTER_SUITE(TestOrientation);
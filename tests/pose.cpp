@@ -33,7 +33,9 @@
 //----------------------------------------------------------------------
 #include "rrlib/util/tUnitTestSuite.h"
 
+#include <cmath>
 #include <cstring>
+#include <vector>
 
 #include "rrlib/localization/tPose.h"
 #include "rrlib/localization/tUncertainPose.h"
@@ -81,9 +83,19 @@ class TestPose : public util::tUnitTestSuite
   RRLIB_UNIT_TESTS_ADD_TEST(AssignmentOperators);
   RRLIB_UNIT_TESTS_ADD_TEST(ArithmeticOperators);
   RRLIB_UNIT_TESTS_ADD_TEST(ReferenceTransformations);
+  RRLIB_UNIT_TESTS_ADD_TEST(RelativePoseTransformations);
+  RRLIB_UNIT_TESTS_ADD_TEST(Inversion);
+  RRLIB_UNIT_TESTS_ADD_TEST(BatchTransformations);
+  RRLIB_UNIT_TESTS_ADD_TEST(ExponentialMap);
+  RRLIB_UNIT_TESTS_ADD_TEST(Interpolation);
+  RRLIB_UNIT_TESTS_ADD_TEST(PoseArrays);
+  RRLIB_UNIT_TESTS_ADD_TEST(QuaternionPose);
+  RRLIB_UNIT_TESTS_ADD_TEST(PoseWithCache);
   RRLIB_UNIT_TESTS_ADD_TEST(Streaming);
   RRLIB_UNIT_TESTS_ADD_TEST(UnitChanges);
   RRLIB_UNIT_TESTS_ADD_TEST(Uncertainty);
+  RRLIB_UNIT_TESTS_ADD_TEST(UncertainCompounding);
+  RRLIB_UNIT_TESTS_ADD_TEST(PackedCovariance);
   RRLIB_UNIT_TESTS_ADD_TEST(MultiplyVelocityWithFactor);
   RRLIB_UNIT_TESTS_END_SUITE;
 
@@ -261,6 +273,329 @@ private:
     RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D(7.12685279298953, 1.66258966535201, -0.83292548989809, rrlib::math::tAngleDeg(146.09730144611353), rrlib::math::tAngleDeg(-58.43157586071569), rrlib::math::tAngleDeg(101.53514216427203)), tPose3D(4, 0, 0.5, rrlib::math::tAngleDeg(100), rrlib::math::tAngleDeg(-150), rrlib::math::tAngleDeg(50)).GetPoseInLocalFrame(tPose3D(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(130), rrlib::math::tAngleDeg(110))), 1E-14));
   }
 
+  void RelativePoseTransformations()
+  {
+    typedef localization::tPose2D<double> tPose2D;
+    tPose2D pose_2d(1, 2, rrlib::math::tAngleDeg(30));
+    tPose2D relative_2d(3, -1, rrlib::math::tAngleDeg(170));
+    tPose2D expected_2d(pose_2d.GetTransformationMatrix() * relative_2d.GetTransformationMatrix());
+    pose_2d.ApplyRelativePoseTransformation(relative_2d);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_2d, pose_2d, 1E-12));
+
+    typedef localization::tPose3D<double> tPose3D;
+    tPose3D pose_3d(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(120));
+    tPose3D relative_3d(-2, 0.5, 4, rrlib::math::tAngleDeg(-70), rrlib::math::tAngleDeg(20), rrlib::math::tAngleDeg(95));
+    tPose3D expected_3d(pose_3d.GetTransformationMatrix() * relative_3d.GetTransformationMatrix());
+    const tPose3D original_3d = pose_3d;
+    pose_3d.ApplyRelativePoseTransformation(relative_3d);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected_3d, pose_3d, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(relative_3d.GetPoseInParentFrame(original_3d), pose_3d, 1E-12));
+
+    // the orientation is R * R_rel, not R_rel * R as in the composition before the closed form
+    tPose3D rotated_first = original_3d;
+    rotated_first.Rotate(relative_3d.Orientation().GetMatrix());
+    RRLIB_UNIT_TESTS_ASSERT(!IsEqual(rotated_first.Orientation(), pose_3d.Orientation(), 1E-3));
+
+    // in gimbal lock roll and yaw are not unique, so compare the resulting transformations
+    tPose3D gimbal_lock(1, 2, 3, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(45), rrlib::math::tAngleDeg(120));
+    tPose3D relative_gimbal_lock(0, 0, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(45), rrlib::math::tAngleDeg(0));
+    math::tMatrix<4, 4, double> expected_matrix = gimbal_lock.GetTransformationMatrix() * relative_gimbal_lock.GetTransformationMatrix();
+    gimbal_lock.ApplyRelativePoseTransformation(relative_gimbal_lock);
+    math::tMatrix<4, 4, double> actual_matrix = gimbal_lock.GetTransformationMatrix();
+    for (size_t i = 0; i < 4; ++i)
+    {
+      for (size_t j = 0; j < 4; ++j)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(expected_matrix[i][j], actual_matrix[i][j], 1E-9);
+      }
+    }
+  }
+
+  void Inversion()
+  {
+    typedef localization::tPose2D<double> tPose2D;
+    tPose2D pose_2d(1, 2, rrlib::math::tAngleDeg(30));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(pose_2d.GetTransformationMatrix().Inverse()), pose_2d.Inverted(), 1E-12));
+    tPose2D identity_2d(pose_2d);
+    identity_2d.ApplyRelativePoseTransformation(pose_2d.Inverted());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(), identity_2d, 1E-12));
+    pose_2d.Invert();
+    pose_2d.Invert();
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(1, 2, rrlib::math::tAngleDeg(30)), pose_2d, 1E-12));
+
+    typedef localization::tPose3D<double> tPose3D;
+    tPose3D pose_3d(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(120));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D(pose_3d.GetTransformationMatrix().Inverse()), pose_3d.Inverted(), 1E-12));
+    tPose3D identity_3d(pose_3d);
+    identity_3d.ApplyRelativePoseTransformation(pose_3d.Inverted());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D(), identity_3d, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose_3d.Inverted(), tPose3D().GetPoseInLocalFrame(pose_3d), 1E-12));
+
+    tPose3D reference(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose_3d, pose_3d.GetPoseInLocalFrame(reference).GetPoseInParentFrame(reference), 1E-12));
+
+    // rotated references far from the origin, e.g. in UTM coordinates, must not lose the precision of the offset
+    const tPose2D utm_reference_2d(500000, 5400000, rrlib::math::tAngleDeg(30));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(1, 2, rrlib::math::tAngleDeg(40)).GetPoseInLocalFrame(tPose2D(0, 0, rrlib::math::tAngleDeg(30))), tPose2D(500001, 5400002, rrlib::math::tAngleDeg(40)).GetPoseInLocalFrame(utm_reference_2d), 1E-12));
+    typedef localization::tPose2D<float> tPose2DFloat;
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2DFloat(1, 2, rrlib::math::tAngleDeg(40)).GetPoseInLocalFrame(tPose2DFloat(0, 0, rrlib::math::tAngleDeg(30))), tPose2DFloat(500001, 5400002, rrlib::math::tAngleDeg(40)).GetPoseInLocalFrame(tPose2DFloat(500000, 5400000, rrlib::math::tAngleDeg(30))), 1E-5));
+    const tPose3D utm_reference_3d(500000, 5400000, 300, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-20), rrlib::math::tAngleDeg(30));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(120)).GetPoseInLocalFrame(tPose3D(0, 0, 0, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-20), rrlib::math::tAngleDeg(30))),
+                                    tPose3D(500001, 5400002, 303, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(120)).GetPoseInLocalFrame(utm_reference_3d), 1E-12));
+  }
+
+  void BatchTransformations()
+  {
+    typedef localization::tPose2D<double> tPose2D;
+    const tPose2D reference_2d(1, 5, rrlib::math::tAngleDeg(110));
+    std::vector<tPose2D> poses_2d;
+    std::vector<tPosition2D<double>> positions_2d;
+    for (int i = 0; i < 10; ++i)
+    {
+      poses_2d.push_back(tPose2D(i, 2 - i, rrlib::math::tAngleDeg(35 * i)));
+      positions_2d.push_back(poses_2d.back().Position());
+    }
+    std::vector<tPose2D> transformed_poses_2d(poses_2d.size());
+    TransformPoses(reference_2d, poses_2d.data(), poses_2d.size(), transformed_poses_2d.data());
+    TransformPositions(reference_2d, positions_2d.data(), positions_2d.size(), positions_2d.data());
+    for (size_t i = 0; i < poses_2d.size(); ++i)
+    {
+      tPose2D expected = poses_2d[i].GetPoseInParentFrame(reference_2d);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, transformed_poses_2d[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.Position(), positions_2d[i], 1E-12));
+    }
+
+    typedef localization::tPose3D<double> tPose3D;
+    const tPose3D reference_3d(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+    std::vector<tPose3D> poses_3d;
+    std::vector<tPosition3D<double>> positions_3d;
+    for (int i = 0; i < 10; ++i)
+    {
+      poses_3d.push_back(tPose3D(i, 2 - i, 0.5 * i, rrlib::math::tAngleDeg(10 * i), rrlib::math::tAngleDeg(-8 * i), rrlib::math::tAngleDeg(35 * i)));
+      positions_3d.push_back(poses_3d.back().Position());
+    }
+    std::vector<tPose3D> transformed_poses_3d(poses_3d.size());
+    std::vector<tPosition3D<double>> transformed_positions_3d(positions_3d.size());
+    TransformPoses(reference_3d, poses_3d.data(), poses_3d.size(), transformed_poses_3d.data());
+    TransformPositions(reference_3d, positions_3d.data(), positions_3d.size(), transformed_positions_3d.data());
+    for (size_t i = 0; i < poses_3d.size(); ++i)
+    {
+      tPose3D expected = poses_3d[i].GetPoseInParentFrame(reference_3d);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, transformed_poses_3d[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.Position(), transformed_positions_3d[i], 1E-12));
+    }
+
+    TransformPositions(reference_3d.Inverted(), transformed_positions_3d.data(), transformed_positions_3d.size(), transformed_positions_3d.data());
+    for (size_t i = 0; i < positions_3d.size(); ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(positions_3d[i], transformed_positions_3d[i], 1E-12));
+    }
+  }
+
+  void ExponentialMap()
+  {
+    typedef localization::tPose2D<double> tPose2D;
+    const si_units::tTime<double> time(2);
+    tTwist2D<double> twist_2d(1, 0, tTwist2D<double>::tOrientationComponent<>(M_PI / 4));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(2 / M_PI * 2, 2 / M_PI * 2, rrlib::math::tAngleRad(M_PI / 2)), Exp(twist_2d, time), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(1, 2), Exp(tPose2D(1, 2)), 1E-12));
+    for (int i = 0; i < 10; ++i)
+    {
+      tPose2D pose(i, 2 - i, rrlib::math::tAngleDeg(35 * i - 170));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose, Exp(Log(pose)), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose, Exp(Log(pose) / time, time), 1E-12));
+    }
+
+    typedef localization::tPose3D<double> tPose3D;
+    tTwist3D<double> twist_3d(1, 0.5, -0.2, tTwist3D<double>::tOrientationComponent<>(0.3), tTwist3D<double>::tOrientationComponent<>(-0.2), tTwist3D<double>::tOrientationComponent<>(0.7));
+    tPose3D integrated;
+    const size_t cSTEPS = 10000;
+    for (size_t i = 0; i < cSTEPS; ++i)
+    {
+      integrated.ApplyRelativePoseTransformation(twist_3d * si_units::tTime<double>(2.0 / cSTEPS));
+    }
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(integrated, Exp(twist_3d, time), 1E-3));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D(1, 2, 3), Exp(tPose3D(1, 2, 3)), 1E-12));
+    for (int i = 0; i < 10; ++i)
+    {
+      tPose3D pose(i, 2 - i, 0.5 * i, rrlib::math::tAngleDeg(10 * i), rrlib::math::tAngleDeg(-8 * i), rrlib::math::tAngleDeg(35 * i));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose, Exp(Log(pose)), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose, Exp(Log(pose) / time, time), 1E-12));
+    }
+    tPose3D small_rotation(1, 2, 3, rrlib::math::tAngleRad(1E-9), rrlib::math::tAngleRad(-2E-9), rrlib::math::tAngleRad(0));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(small_rotation, Exp(Log(small_rotation)), 1E-12));
+  }
+
+  void Interpolation()
+  {
+    const tInterpolationMethod methods[] = { eIM_SLERP, eIM_NLERP, eIM_GEODESIC };
+    const double factors[] = { 0, 0.25, 0.5, 1, 1.5 };
+
+    typedef localization::tPose2D<double> tPose2D;
+    const tPose2D start_2d(1, 2, rrlib::math::tAngleDeg(170));
+    const tPose2D end_2d(3, -2, rrlib::math::tAngleDeg(-170));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(1.5, 1, rrlib::math::tAngleDeg(175)), Interpolate(start_2d, end_2d, 0.25), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(4, -4, rrlib::math::tAngleDeg(-160)), Interpolate(start_2d, end_2d, 1.5), 1E-12));
+    for (auto method : methods)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(start_2d, Interpolate(start_2d, end_2d, 0, method), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(end_2d, Interpolate(start_2d, end_2d, 1, method), 1E-12));
+      tPose2D batch_2d[5];
+      Interpolate(start_2d, end_2d, factors, 5, batch_2d, method);
+      for (size_t i = 0; i < 5; ++i)
+      {
+        RRLIB_UNIT_TESTS_ASSERT(IsEqual(Interpolate(start_2d, end_2d, factors[i], method), batch_2d[i], 1E-12));
+      }
+    }
+
+    typedef localization::tPose3D<double> tPose3D;
+    const tPose3D start_3d(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(170));
+    const tPose3D end_3d(-1, 5, 5, rrlib::math::tAngleDeg(-20), rrlib::math::tAngleDeg(30), rrlib::math::tAngleDeg(-150));
+    for (auto method : methods)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(start_3d, Interpolate(start_3d, end_3d, 0, method), 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(end_3d, Interpolate(start_3d, end_3d, 1, method), 1E-12));
+      tPose3D batch_3d[5];
+      Interpolate(start_3d, end_3d, factors, 5, batch_3d, method);
+      for (size_t i = 0; i < 5; ++i)
+      {
+        RRLIB_UNIT_TESTS_ASSERT(IsEqual(Interpolate(start_3d, end_3d, factors[i], method), batch_3d[i], 1E-12));
+      }
+    }
+    const tPose3D yaw_start(0, 0, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(170));
+    const tPose3D yaw_end(2, 0, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(-150));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D(0.25, 0, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(175)), Interpolate(yaw_start, yaw_end, 0.125), 1E-12));
+
+    const tPose3D midway = Interpolate(start_3d, end_3d, 0.5, eIM_SLERP);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(midway.Orientation(), Interpolate(start_3d, end_3d, 0.5, eIM_NLERP).Orientation(), 1E-12));
+    const tPose3D close(1.01, 2, 3, rrlib::math::tAngleDeg(11), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(171));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(Interpolate(start_3d, close, 0.3, eIM_SLERP), Interpolate(start_3d, close, 0.3, eIM_NLERP), 1E-6));
+
+    const tPose3D tangent(1, 0.5, -0.2, rrlib::math::tAngleRad(0.3), rrlib::math::tAngleRad(-0.2), rrlib::math::tAngleRad(0.7));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(Exp(tangent * 0.25), Interpolate(tPose3D(), Exp(tangent), 0.25, eIM_GEODESIC), 1E-12));
+  }
+
+  void PoseArrays()
+  {
+    typedef localization::tPose2D<double> tPose2D;
+    const tPose2D relative_2d(-2, 0.5, rrlib::math::tAngleDeg(95));
+    const tPose2D reference_2d(1, 5, rrlib::math::tAngleDeg(110));
+    tPoseArray2D<double> array_2d;
+    for (int i = 0; i < 10; ++i)
+    {
+      array_2d.PushBack(tPose2D(i, 2 - i, rrlib::math::tAngleDeg(35 * i)));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(10), array_2d.Size());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose2D(3, -1, rrlib::math::tAngleDeg(105)), array_2d[3], 1E-12));
+
+    tPoseArray2D<double> composed_2d(array_2d);
+    composed_2d.ApplyRelativePoseTransformation(relative_2d);
+    tPoseArray2D<double> local_2d;
+    array_2d.GetPosesInLocalFrame(reference_2d, local_2d);
+    tPoseArray2D<double> inverted_2d(array_2d);
+    inverted_2d.Invert();
+    std::vector<double> distances_2d(array_2d.Size());
+    array_2d.GetDistances(reference_2d.Position(), distances_2d.data());
+    size_t index = 0;
+    for (auto it = array_2d.begin(); it != array_2d.end(); ++it, ++index)
+    {
+      const tPose2D pose = *it;
+      tPose2D expected = pose;
+      expected.ApplyRelativePoseTransformation(relative_2d);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, composed_2d[index], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInLocalFrame(reference_2d), local_2d[index], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.Inverted(), inverted_2d[index], 1E-12));
+      const double dx = pose.X().Value() - reference_2d.X().Value();
+      const double dy = pose.Y().Value() - reference_2d.Y().Value();
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(std::sqrt(dx * dx + dy * dy), distances_2d[index], 1E-12);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(array_2d.Size(), index);
+
+    typedef localization::tPose3D<double> tPose3D;
+    const tPose3D relative_3d(-2, 0.5, 4, rrlib::math::tAngleDeg(-70), rrlib::math::tAngleDeg(20), rrlib::math::tAngleDeg(95));
+    const tPose3D reference_3d(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+    tPoseArray3D<double> array_3d;
+    for (int i = 0; i < 10; ++i)
+    {
+      array_3d.PushBack(tPose3D(i, 2 - i, 0.5 * i, rrlib::math::tAngleDeg(10 * i), rrlib::math::tAngleDeg(-8 * i), rrlib::math::tAngleDeg(35 * i)));
+    }
+
+    tPoseArray3D<double> composed_3d(array_3d);
+    composed_3d.ApplyRelativePoseTransformation(relative_3d);
+    tPoseArray3D<double> composed_elementwise_3d(array_3d);
+    composed_elementwise_3d.ApplyRelativePoseTransformation(array_3d);
+    tPoseArray3D<double> local_3d(array_3d);
+    local_3d.GetPosesInLocalFrame(reference_3d, local_3d);
+    tPoseArray3D<double> inverted_3d(array_3d);
+    inverted_3d.Invert();
+    for (size_t i = 0; i < array_3d.Size(); ++i)
+    {
+      const tPose3D pose = array_3d[i];
+      tPose3D expected = pose;
+      expected.ApplyRelativePoseTransformation(relative_3d);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, composed_3d[i], 1E-12));
+      expected = pose;
+      expected.ApplyRelativePoseTransformation(pose);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, composed_elementwise_3d[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInLocalFrame(reference_3d), local_3d[i], 1E-12));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.Inverted(), inverted_3d[i], 1E-12));
+    }
+  }
+
+  void QuaternionPose()
+  {
+    typedef localization::tPose3D<double> tPose3D;
+    tPose3D pose(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(120));
+    tPose3D relative(-2, 0.5, 4, rrlib::math::tAngleDeg(-70), rrlib::math::tAngleDeg(20), rrlib::math::tAngleDeg(95));
+    tPose3D reference(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+
+    tQuaternionPose<double> quaternion_pose(pose);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose, tPose3D(quaternion_pose), 1E-12));
+
+    tPose3D expected = pose;
+    expected.ApplyRelativePoseTransformation(relative);
+    quaternion_pose.ApplyRelativePoseTransformation(relative);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, tPose3D(quaternion_pose), 1E-12));
+
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInParentFrame(reference), tPose3D(tQuaternionPose<double>(pose).GetPoseInParentFrame(reference)), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInLocalFrame(reference), tPose3D(tQuaternionPose<double>(pose).GetPoseInLocalFrame(reference)), 1E-12));
+
+    tQuaternionPose<double> composed(pose);
+    composed.ApplyRelativePoseTransformation(composed.Inverted());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tQuaternionPose<double>(), composed, 1E-12));
+  }
+
+  void PoseWithCache()
+  {
+    typedef localization::tPose3D<double> tPose3D;
+    tPose3D pose(1, 2, 3, rrlib::math::tAngleDeg(10), rrlib::math::tAngleDeg(-40), rrlib::math::tAngleDeg(120));
+    tPose3D relative(-2, 0.5, 4, rrlib::math::tAngleDeg(-70), rrlib::math::tAngleDeg(20), rrlib::math::tAngleDeg(95));
+    tPose3D reference(1, 5, 5, rrlib::math::tAngleDeg(-100), rrlib::math::tAngleDeg(50), rrlib::math::tAngleDeg(110));
+
+    tPoseWithCache<double> cached_pose(pose);
+    tPoseWithCache<double> cached_reference(reference);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInParentFrame(reference), cached_pose.GetPoseInParentFrame(cached_reference), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInLocalFrame(reference), cached_pose.GetPoseInLocalFrame(cached_reference), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInParentFrame(reference).Position(), cached_reference.TransformToParentFrame(pose.Position()), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose.GetPoseInLocalFrame(reference).Position(), cached_reference.TransformToLocalFrame(pose.Position()), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D(pose.GetTransformationMatrix()), tPose3D(cached_pose.GetTransformationMatrix()), 1E-12));
+
+    tPose3D expected = pose;
+    expected.ApplyRelativePoseTransformation(relative);
+    cached_pose.ApplyRelativePoseTransformation(relative);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, cached_pose.Pose(), 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.GetPoseInLocalFrame(reference), cached_pose.GetPoseInLocalFrame(cached_reference), 1E-12));
+
+    cached_reference.SetYaw(rrlib::math::tAngleDeg(-30));
+    reference.Yaw() = rrlib::math::tAngleDeg(-30);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.GetPoseInParentFrame(reference), cached_pose.GetPoseInParentFrame(cached_reference), 1E-12));
+    cached_reference.Rotate(rrlib::math::tAngleDeg(5), rrlib::math::tAngleDeg(15), rrlib::math::tAngleDeg(25));
+    reference.Rotate(rrlib::math::tAngleDeg(5), rrlib::math::tAngleDeg(15), rrlib::math::tAngleDeg(25));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected.GetPoseInParentFrame(reference), cached_pose.GetPoseInParentFrame(cached_reference), 1E-12));
+    cached_reference = tPose3D();
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(expected, cached_pose.GetPoseInParentFrame(cached_reference), 1E-12));
+  }
+
   void Streaming()
   {
     std::stringstream actual;
@@ -423,6 +758,146 @@ private:
     RRLIB_UNIT_TESTS_EQUALITY(tPose3D<>(3, 4, 5, math::tAngleDeg(6), math::tAngleDeg(7), math::tAngleDeg(8)), static_cast<const tPose3D<> &>(pose_6));
     RRLIB_UNIT_TESTS_EQUALITY((math::tMatrix<6, 6, double>(1, 2, 3, 4, 5, 6, 2, 4, 5, 6, 7, 8, 3, 5, 7, 8, 9, 10, 4, 6, 8, 10, 11, 12, 5, 7, 9, 11, 13, 14, 6, 8, 10, 12, 14, 16)), pose_6.Covariance());
   }
+
+  void UncertainCompounding()
+  {
+    // an uncertain heading turns into lateral uncertainty when moving straight ahead for 1 m
+    tUncertainPose2D<> pose_2d(0, 0, math::tAngleDeg(0), math::tMatrix<3, 3, double>(0, 0, 0, 0, 0, 0, 0, 0, 0.01));
+    pose_2d.Compound(tUncertainPose2D<>(1, 0, math::tAngleDeg(0), math::tMatrix<3, 3, double>()));
+    RRLIB_UNIT_TESTS_EQUALITY(tPose2D<>(1, 0), static_cast<const tPose2D<> &>(pose_2d));
+    RRLIB_UNIT_TESTS_EQUALITY((math::tMatrix<3, 3, double>(0, 0, 0, 0, 0.01, 0.01, 0, 0.01, 0.01)), pose_2d.Covariance());
+
+    // the uncertainty of the relative transformation is rotated into the parent frame
+    pose_2d = tUncertainPose2D<>(0, 0, math::tAngleDeg(90), math::tMatrix<3, 3, double>());
+    pose_2d.Compound(tUncertainPose2D<>(0, 0, math::tAngleDeg(0), math::tMatrix<3, 3, double>(0.04, 0, 0, 0, 0, 0, 0, 0, 0)));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0, pose_2d.CovarianceXX(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.04, pose_2d.CovarianceYY(), 1E-9);
+
+    // inverting twice yields the original pose and covariance, compounding with the inverse the identity
+    const tUncertainPose2D<> uncertain_2d(1, 2, math::tAngleDeg(30), math::tMatrix<3, 3, double>(0.3, 0.1, 0.05, 0.1, 0.2, 0.02, 0.05, 0.02, 0.1));
+    pose_2d = uncertain_2d.Inverted();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<const tPose2D<> &>(uncertain_2d).Inverted(), static_cast<const tPose2D<> &>(pose_2d));
+    pose_2d.Invert();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<const tPose2D<> &>(uncertain_2d), static_cast<const tPose2D<> &>(pose_2d));
+    for (size_t i = 0; i < 3; ++i)
+    {
+      for (size_t j = 0; j < 3; ++j)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(uncertain_2d.Covariance()[i][j], pose_2d.Covariance()[i][j], 1E-9);
+      }
+    }
+    pose_2d.Compound(uncertain_2d.Inverted());
+    RRLIB_UNIT_TESTS_EQUALITY(tPose2D<>(), static_cast<const tPose2D<> &>(pose_2d));
+
+    tUncertainPose3D<> pose_3d;
+    pose_3d.CovarianceYawYaw() = 0.01;
+    pose_3d.Compound(tUncertainPose3D<>(1, 0, 0, math::tMatrix<6, 6, double>()));
+    RRLIB_UNIT_TESTS_EQUALITY(tPose3D<>(1, 0, 0), static_cast<const tPose3D<> &>(pose_3d));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.01, pose_3d.CovarianceYY(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.01, pose_3d.CovarianceYYaw(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.01, pose_3d.CovarianceYawYaw(), 1E-9);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0, pose_3d.CovarianceXX(), 1E-9);
+
+    tUncertainPose3D<> uncertain_3d(1, 2, 3, math::tAngleDeg(10), math::tAngleDeg(-20), math::tAngleDeg(30), math::tMatrix<6, 6, double>());
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        uncertain_3d.Covariance()[i][j] = i == j ? 0.1 * (i + 1) : 0.01;
+      }
+    }
+    pose_3d = uncertain_3d.Inverted();
+    pose_3d.Invert();
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<const tPose3D<> &>(uncertain_3d), static_cast<const tPose3D<> &>(pose_3d));
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(uncertain_3d.Covariance()[i][j], pose_3d.Covariance()[i][j], 1E-9);
+      }
+    }
+    pose_3d.Compound(uncertain_3d.Inverted());
+    RRLIB_UNIT_TESTS_EQUALITY(tPose3D<>(), static_cast<const tPose3D<> &>(pose_3d));
+  }
+
+  void PackedCovariance()
+  {
+    math::tMatrix<6, 6, double> covariance;
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        covariance[i][j] = i == j ? 0.1 * (i + 1) : 0.01 * (i + j);
+      }
+    }
+    const tUncertainPose3D<> uncertain_3d(1, 2, 3, math::tAngleDeg(10), math::tAngleDeg(-20), math::tAngleDeg(30), covariance);
+
+    // packing keeps the pose and the named accessors, unpacking restores the dense matrix
+    tPackedUncertainPose3D<> packed_3d(uncertain_3d);
+    RRLIB_UNIT_TESTS_EQUALITY(static_cast<const tPose3D<> &>(uncertain_3d), static_cast<const tPose3D<> &>(packed_3d));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(21), tPackedUncertainPose3D<>::tCovariance::cNUMBER_OF_VALUES);
+    RRLIB_UNIT_TESTS_EQUALITY(uncertain_3d.CovarianceXYaw(), packed_3d.CovarianceXYaw());
+    RRLIB_UNIT_TESTS_EQUALITY(uncertain_3d.CovarianceRollPitch(), packed_3d.CovarianceRollPitch());
+    RRLIB_UNIT_TESTS_EQUALITY(uncertain_3d.VariancePitch(), packed_3d.VariancePitch());
+    RRLIB_UNIT_TESTS_EQUALITY(covariance[5][0], packed_3d.Covariance()(5, 0));
+    RRLIB_UNIT_TESTS_EQUALITY(covariance, packed_3d.GetUncertainPose().Covariance());
+
+    packed_3d.CovarianceYZ() = 0.5;
+    RRLIB_UNIT_TESTS_EQUALITY(0.5, packed_3d.Covariance()(2, 1));
+
+    // the symmetric kernels match their dense counterparts
+    double jacobian[6][6];
+    double vector[6];
+    for (size_t i = 0; i < 6; ++i)
+    {
+      vector[i] = i + 1.0;
+      for (size_t j = 0; j < 6; ++j)
+      {
+        jacobian[i][j] = std::sin(i + 2.0 * j);
+      }
+    }
+
+    tPackedCovariance<6> packed(covariance);
+    double product[6];
+    packed.Multiply(vector, product);
+    for (size_t i = 0; i < 6; ++i)
+    {
+      double expected = 0;
+      for (size_t j = 0; j < 6; ++j)
+      {
+        expected += covariance[i][j] * vector[j];
+      }
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(expected, product[i], 1E-9);
+    }
+
+    tPackedCovariance<6> accumulated(packed);
+    accumulated.AddCongruenceTransform(packed, jacobian, 2);
+    packed.CongruenceTransform(jacobian);
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        double expected = 0;
+        for (size_t k = 0; k < 6; ++k)
+        {
+          for (size_t l = 0; l < 6; ++l)
+          {
+            expected += jacobian[i][k] * covariance[k][l] * jacobian[j][l];
+          }
+        }
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(expected, packed(i, j), 1E-9);
+        RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(covariance[i][j] + 2 * expected, accumulated(i, j), 1E-9);
+      }
+    }
+
+    tPackedUncertainPose2D<> packed_2d(tUncertainPose2D<>(1, 2, math::tAngleDeg(30), math::tMatrix<3, 3, double>(0.3, 0.1, 0.05, 0.1, 0.2, 0.02, 0.05, 0.02, 0.1)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(6), tPackedUncertainPose2D<>::tCovariance::cNUMBER_OF_VALUES);
+    RRLIB_UNIT_TESTS_EQUALITY(0.02, packed_2d.CovarianceYYaw());
+    packed_2d.Covariance() += packed_2d.Covariance();
+    RRLIB_UNIT_TESTS_EQUALITY(0.04, packed_2d.CovarianceYYaw());
+    packed_2d.Covariance() *= 0.5;
+    RRLIB_UNIT_TESTS_EQUALITY(0.2, packed_2d.VarianceY());
+  }
 };
 
 RRLIB_UNIT_TESTS_REGISTER_SUITE(TestPose);
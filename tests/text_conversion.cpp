@@ -0,0 +1,303 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tests/text_conversion.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <clocale>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "rrlib/localization/text_conversion.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestTextConversion : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestTextConversion);
+  RRLIB_UNIT_TESTS_ADD_TEST(Orientations);
+  RRLIB_UNIT_TESTS_ADD_TEST(Poses);
+  RRLIB_UNIT_TESTS_ADD_TEST(UncertainPoses);
+  RRLIB_UNIT_TESTS_ADD_TEST(Errors);
+  RRLIB_UNIT_TESTS_ADD_TEST(Locale);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  template <typename T>
+  std::string Format(const T &value)
+  {
+    char buffer[1024];
+    const tToCharsResult result = ToChars(buffer, buffer + sizeof(buffer), value);
+    RRLIB_UNIT_TESTS_ASSERT(result.ec == std::errc());
+    return std::string(buffer, result.ptr);
+  }
+
+  template <typename T>
+  void Parse(const std::string &text, T &value)
+  {
+    const tFromCharsResult result = FromChars(text.data(), text.data() + text.size(), value);
+    RRLIB_UNIT_TESTS_ASSERT(result.ec == std::errc());
+    RRLIB_UNIT_TESTS_ASSERT(result.ptr == text.data() + text.size());
+  }
+
+  template <typename T>
+  std::string Stream(const T &value)
+  {
+    std::stringstream stream;
+    stream << value;
+    return stream.str();
+  }
+
+  void Orientations()
+  {
+    typedef math::tAngle<double, math::angle::Degree> tDegree;
+
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("90°"), Format(tOrientation2D<double>(math::tAngle<double, math::angle::Radian>(5 * M_PI_2))));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("(1°, 2°, 3°)"), Format(tOrientation3D<double>(tDegree(1), tDegree(2), tDegree(3))));
+
+    tOrientation2D<double> orientation_2d;
+    Parse("120°", orientation_2d);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tOrientation2D<double>(tDegree(120)), orientation_2d));
+    Parse(" -45", orientation_2d);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tOrientation2D<double>(tDegree(-45)), orientation_2d));
+
+    tOrientation3D<double> orientation_3d;
+    Parse("(10°, 20°, 30°)", orientation_3d);
+    RRLIB_UNIT_TESTS_EQUALITY(tOrientation3D<double>(tDegree(10), tDegree(20), tDegree(30)), orientation_3d);
+    Parse("( 10 ,20,  30 )", orientation_3d);
+    RRLIB_UNIT_TESTS_EQUALITY(tOrientation3D<double>(tDegree(10), tDegree(20), tDegree(30)), orientation_3d);
+
+    // consecutive values like with the stream operators
+    const std::string text = "(1°, 2°, 3°), (2°, 3°, 4°), ende";
+    const char *cursor = text.data();
+    for (size_t i = 0; i < 2; ++i)
+    {
+      const tFromCharsResult result = FromChars(cursor, text.data() + text.size(), orientation_3d);
+      RRLIB_UNIT_TESTS_ASSERT(result.ec == std::errc());
+      RRLIB_UNIT_TESTS_EQUALITY(tOrientation3D<double>(tDegree(i + 1.0), tDegree(i + 2.0), tDegree(i + 3.0)), orientation_3d);
+      cursor = result.ptr + 1;
+    }
+  }
+
+  void Poses()
+  {
+    typedef math::tAngle<double, math::angle::Degree> tDegree;
+
+    const tPose2D<> pose_2d(1, 2, tDegree(90));
+    RRLIB_UNIT_TESTS_EQUALITY(Stream(pose_2d), Format(pose_2d));
+    const tPose3D<> pose_3d(1, 2, 3, tDegree(4), tDegree(5), tDegree(6));
+    RRLIB_UNIT_TESTS_EQUALITY(std::string("(1, 2, 3, 4°, 5°, 6°)"), Format(pose_3d));
+
+    // what the stream operators write is read back
+    tPose2D<> parsed_2d;
+    Parse(Stream(pose_2d), parsed_2d);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose_2d, parsed_2d));
+    tPose3D<> parsed_3d;
+    Parse(Stream(pose_3d), parsed_3d);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose_3d, parsed_3d));
+
+    // and what is written here is read back exactly
+    const tPose3D<> odd(0.1, 1.0 / 3, -1E-20, math::tAngle<double, math::angle::Radian>(0.1), math::tAngle<double, math::angle::Radian>(-1), math::tAngle<double, math::angle::Radian>(3));
+    Parse(Format(odd), parsed_3d);
+    RRLIB_UNIT_TESTS_EQUALITY(odd.X().Value(), parsed_3d.X().Value());
+    RRLIB_UNIT_TESTS_EQUALITY(odd.Y().Value(), parsed_3d.Y().Value());
+    RRLIB_UNIT_TESTS_EQUALITY(odd.Z().Value(), parsed_3d.Z().Value());
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(odd, parsed_3d, 1E-12));
+
+    std::stringstream stream(Format(odd));
+    stream >> parsed_3d;
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(odd, parsed_3d, 1E-12));
+
+    tPose3D<float> parsed_float;
+    Parse("(+1.5, 2, 3e2, 0°, 0°, 90°)", parsed_float);
+    RRLIB_UNIT_TESTS_EQUALITY(1.5f, parsed_float.X().Value());
+    RRLIB_UNIT_TESTS_EQUALITY(300.f, parsed_float.Z().Value());
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(M_PI_2, parsed_float.Yaw().Value().Value(), 1E-6);
+  }
+
+  void UncertainPoses()
+  {
+    tUncertainPose2D<> pose(1, 2, math::tAngle<double, math::angle::Degree>(30), tUncertainPose2D<>::tCovarianceMatrix<>());
+    for (size_t i = 0; i < 3; ++i)
+    {
+      for (size_t j = 0; j < 3; ++j)
+      {
+        pose.Covariance()[i][j] = 0.1 * (i + 1) * (j + 1);
+      }
+    }
+
+    tUncertainPose2D<> parsed;
+    Parse(Format(pose), parsed);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(static_cast<const tPose2D<> &>(pose), static_cast<const tPose2D<> &>(parsed), 1E-12));
+    for (size_t i = 0; i < 3; ++i)
+    {
+      for (size_t j = 0; j < 3; ++j)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY(pose.Covariance()[i][j], parsed.Covariance()[i][j]);
+      }
+    }
+
+    tUncertainPose2D<> streamed;
+    Parse(Stream(pose), streamed);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(static_cast<const tPose2D<> &>(pose), static_cast<const tPose2D<> &>(streamed)));
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.9, streamed.Covariance()[2][2], 1E-12);
+
+    tUncertainPose3D<> pose_3d;
+    pose_3d.Covariance()[5][0] = 4;
+    tUncertainPose3D<> parsed_3d;
+    Parse(Format(pose_3d), parsed_3d);
+    RRLIB_UNIT_TESTS_EQUALITY(4.0, parsed_3d.Covariance()[5][0]);
+    RRLIB_UNIT_TESTS_EQUALITY(0.0, parsed_3d.Covariance()[0][5]);
+  }
+
+  void Errors()
+  {
+    const tPose3D<> original(1, 2, 3, math::tAngle<double, math::angle::Degree>(4), math::tAngle<double, math::angle::Degree>(5), math::tAngle<double, math::angle::Degree>(6));
+
+    // failures neither advance nor modify the target
+    for (const char *text : { "", "(1, 2, 3, 4, 5)", "(1, 2, 3, 4, 5, 6", "1, 2, 3, 4, 5, 6)", "(1, 2, 3, 4, 5; 6)", "(1, 2, x, 4, 5, 6)" })
+    {
+      tPose3D<> pose = original;
+      const tFromCharsResult result = FromChars(text, text + std::strlen(text), pose);
+      RRLIB_UNIT_TESTS_ASSERT(result.ec == std::errc::invalid_argument);
+      RRLIB_UNIT_TESTS_ASSERT(result.ptr == text);
+      RRLIB_UNIT_TESTS_EQUALITY(original, pose);
+    }
+
+    tOrientation2D<double> orientation;
+    const std::string bracketed = "(120)";
+    RRLIB_UNIT_TESTS_ASSERT(FromChars(bracketed.data(), bracketed.data() + bracketed.size(), orientation).ec == std::errc::invalid_argument);
+
+    tPose2D<> pose_2d;
+    const std::string huge = "(1e999, 2, 3°)";
+    RRLIB_UNIT_TESTS_ASSERT(FromChars(huge.data(), huge.data() + huge.size(), pose_2d).ec == std::errc::result_out_of_range);
+
+    // an uncertain pose with broken covariance keeps its mean
+    tUncertainPose2D<> uncertain(1, 2, math::tAngle<double, math::angle::Degree>(3), tUncertainPose2D<>::tCovarianceMatrix<>());
+    const std::string broken = "(5, 6, 7°)((1, 0, 0), (0, 1, 0))";
+    RRLIB_UNIT_TESTS_ASSERT(FromChars(broken.data(), broken.data() + broken.size(), uncertain).ec == std::errc::invalid_argument);
+    RRLIB_UNIT_TESTS_EQUALITY(1.0, uncertain.X().Value());
+
+    // a failing number leaves the cursor in front of the whitespace
+    const std::string letter = "  x";
+    const char *cursor = letter.data();
+    double number = 0;
+    RRLIB_UNIT_TESTS_ASSERT(text_conversion::ParseNumber(cursor, letter.data() + letter.size(), number) == std::errc::invalid_argument);
+    RRLIB_UNIT_TESTS_ASSERT(cursor == letter.data());
+
+    // a long number is either read completely or rejected, but never split into two
+    const std::string long_number = "(0." + std::string(100, '1') + ", 2, 3°)";
+    tPose2D<> long_pose;
+    const tFromCharsResult long_result = FromChars(long_number.data(), long_number.data() + long_number.size(), long_pose);
+    if (long_result.ec == std::errc())
+    {
+      RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(1.0 / 9, long_pose.X().Value(), 1E-15);
+      RRLIB_UNIT_TESTS_EQUALITY(2.0, long_pose.Y().Value());
+    }
+    else
+    {
+      RRLIB_UNIT_TESTS_ASSERT(long_result.ptr == long_number.data());
+    }
+
+    // the buffer is too small
+    char buffer[16];
+    const tToCharsResult result = ToChars(buffer, buffer + sizeof(buffer), original);
+    RRLIB_UNIT_TESTS_ASSERT(result.ec == std::errc::value_too_large);
+    RRLIB_UNIT_TESTS_ASSERT(result.ptr == buffer + sizeof(buffer));
+  }
+
+  void Locale()
+  {
+    // a decimal comma in the global locale must not change the text format
+    const std::string previous_locale = std::setlocale(LC_ALL, nullptr);
+    if (!std::setlocale(LC_ALL, "de_DE.UTF-8") && !std::setlocale(LC_ALL, "de_DE"))
+    {
+      return;
+    }
+
+    const tPose3D<> pose(1.5, -0.25, 3, math::tAngle<double, math::angle::Radian>(0.5), math::tAngle<double, math::angle::Radian>(0), math::tAngle<double, math::angle::Radian>(0.125));
+    const std::string text = Format(pose);
+    tPose3D<> parsed;
+    Parse(text, parsed);
+
+    tPose2D<float> parsed_float;
+    Parse("(1.5, 2.25, 0.5)", parsed_float);
+
+    std::setlocale(LC_ALL, previous_locale.c_str());
+
+    RRLIB_UNIT_TESTS_EQUALITY(std::string::npos, text.find("1,5"));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(pose, parsed, 1E-12));
+    RRLIB_UNIT_TESTS_EQUALITY(1.5f, parsed_float.X().Value());
+    RRLIB_UNIT_TESTS_EQUALITY(2.25f, parsed_float.Y().Value());
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestTextConversion);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
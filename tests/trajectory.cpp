@@ -0,0 +1,157 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tests/trajectory.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include "rrlib/localization/tTrajectory.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestTrajectory : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestTrajectory);
+  RRLIB_UNIT_TESTS_ADD_TEST(RingBuffer);
+  RRLIB_UNIT_TESTS_ADD_TEST(Lookup);
+  RRLIB_UNIT_TESTS_ADD_TEST(Range);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  static time::tTimestamp Timestamp(int milliseconds)
+  {
+    return time::tTimestamp() + std::chrono::milliseconds(milliseconds);
+  }
+
+  void RingBuffer()
+  {
+    tTrajectory<tPose2D<>> trajectory(3);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), trajectory.Capacity());
+    RRLIB_UNIT_TESTS_ASSERT(trajectory.Empty());
+
+    for (int i = 0; i < 5; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(trajectory.Append(Timestamp(100 * i), tPose2D<>(i, 0)));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), trajectory.Size());
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(200) == trajectory.Oldest().timestamp);
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(400) == trajectory.Newest().timestamp);
+    RRLIB_UNIT_TESTS_ASSERT(tPose2D<>(3, 0) == trajectory[1].pose);
+
+    RRLIB_UNIT_TESTS_ASSERT(!trajectory.Append(Timestamp(300), tPose2D<>()));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), trajectory.Size());
+
+    trajectory.Clear();
+    RRLIB_UNIT_TESTS_ASSERT(trajectory.Empty());
+    RRLIB_UNIT_TESTS_ASSERT(trajectory.Append(Timestamp(0), tPose2D<>()));
+  }
+
+  void Lookup()
+  {
+    tTrajectory<tPose3D<>> trajectory(10);
+    tPose3D<> pose;
+    RRLIB_UNIT_TESTS_ASSERT(!trajectory.GetPose(Timestamp(0), pose));
+
+    for (int i = 0; i < 15; ++i)
+    {
+      trajectory.Append(Timestamp(100 * i), tPose3D<>(i, 2 * i, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(20 * i - 180)));
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), trajectory.LowerBound(Timestamp(0)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(1), trajectory.LowerBound(Timestamp(550)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), trajectory.LowerBound(Timestamp(700)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(10), trajectory.LowerBound(Timestamp(2000)));
+
+    RRLIB_UNIT_TESTS_ASSERT(!trajectory.GetPose(Timestamp(450), pose));
+    RRLIB_UNIT_TESTS_ASSERT(!trajectory.GetPose(Timestamp(1450), pose));
+
+    RRLIB_UNIT_TESTS_ASSERT(trajectory.GetPose(Timestamp(500), pose));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D<>(5, 10, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(-80)), pose, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(trajectory.GetPose(Timestamp(1400), pose));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D<>(14, 28, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(100)), pose, 1E-12));
+    RRLIB_UNIT_TESTS_ASSERT(trajectory.GetPose(Timestamp(825), pose));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(tPose3D<>(8.25, 16.5, 0, rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(0), rrlib::math::tAngleDeg(-15)), pose, 1E-12));
+  }
+
+  void Range()
+  {
+    tTrajectory<tPose2D<>> trajectory(10);
+    for (int i = 0; i < 10; ++i)
+    {
+      trajectory.Append(Timestamp(100 * i), tPose2D<>(i, 0));
+    }
+    tTrajectory<tPose2D<>>::tStampedPose samples[10];
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(3), trajectory.GetRange(Timestamp(250), Timestamp(500), samples, 10));
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(300) == samples[0].timestamp);
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(500) == samples[2].timestamp);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), trajectory.GetRange(Timestamp(0), Timestamp(900), samples, 2));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), trajectory.GetRange(Timestamp(950), Timestamp(2000), samples, 10));
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestTrajectory);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
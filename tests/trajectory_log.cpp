@@ -0,0 +1,225 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tests/trajectory_log.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "rrlib/localization/tTrajectoryLog.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const char *cFILE_NAME = "test_trajectory_log.rrtl";
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestTrajectoryLog : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestTrajectoryLog);
+  RRLIB_UNIT_TESTS_ADD_TEST(RoundTrip);
+  RRLIB_UNIT_TESTS_ADD_TEST(Lookup);
+  RRLIB_UNIT_TESTS_ADD_TEST(Range);
+  RRLIB_UNIT_TESTS_ADD_TEST(MissingIndex);
+  RRLIB_UNIT_TESTS_ADD_TEST(InvalidFiles);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  static time::tTimestamp Timestamp(int milliseconds)
+  {
+    return time::tTimestamp() + std::chrono::milliseconds(milliseconds);
+  }
+
+  static tPose3D<> Sample(int i)
+  {
+    return tPose3D<>(0.1 * i, -0.05 * i, 0.002 * i, math::tAngleDeg(0.5 * i), math::tAngleDeg(10), math::tAngleDeg(3 * i - 180));
+  }
+
+  //! Write 100 samples with a spacing of 10 ms in blocks of 7 records
+  static void WriteSamples()
+  {
+    tTrajectoryLogWriter<tPose3D<>> writer(cFILE_NAME, 1E-4, 1E-5, 7);
+    for (int i = 0; i < 100; ++i)
+    {
+      writer.Append(Timestamp(10 * i), Sample(i));
+    }
+  }
+
+  void RoundTrip()
+  {
+    {
+      tTrajectoryLogWriter<tPose3D<>> writer(cFILE_NAME, 1E-4, 1E-5, 7);
+      for (int i = 0; i < 100; ++i)
+      {
+        RRLIB_UNIT_TESTS_ASSERT(writer.Append(Timestamp(10 * i), Sample(i)));
+      }
+      RRLIB_UNIT_TESTS_ASSERT(!writer.Append(Timestamp(500), Sample(0)));
+      RRLIB_UNIT_TESTS_ASSERT(writer.Append(Timestamp(990), Sample(99)));
+      RRLIB_UNIT_TESTS_EQUALITY(size_t(101), writer.Size());
+      writer.Close();
+    }
+
+    tTrajectoryLogReader<tPose3D<>> reader(cFILE_NAME);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(101), reader.Size());
+    RRLIB_UNIT_TESTS_ASSERT(!reader.IndexRecovered());
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(0) == reader.OldestTimestamp());
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(990) == reader.NewestTimestamp());
+
+    int count = 0;
+    reader.ForEach([&](const time::tTimestamp & timestamp, const tPose3D<> &pose)
+    {
+      const int i = std::min(count, 99);
+      RRLIB_UNIT_TESTS_ASSERT(Timestamp(10 * i) == timestamp);
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Sample(i), pose, 1E-4));
+      count++;
+    });
+    RRLIB_UNIT_TESTS_EQUALITY(101, count);
+
+    {
+      tTrajectoryLogWriter<tPose2D<>> writer(cFILE_NAME);
+    }
+    tTrajectoryLogReader<tPose2D<>> empty_reader(cFILE_NAME);
+    RRLIB_UNIT_TESTS_ASSERT(empty_reader.Empty());
+    tPose2D<> pose;
+    RRLIB_UNIT_TESTS_ASSERT(!empty_reader.GetPose(Timestamp(0), pose));
+    std::remove(cFILE_NAME);
+  }
+
+  void Lookup()
+  {
+    WriteSamples();
+    tTrajectoryLogReader<tPose3D<>> reader(cFILE_NAME);
+    tPose3D<> pose;
+    RRLIB_UNIT_TESTS_ASSERT(!reader.GetPose(Timestamp(-1), pose));
+    RRLIB_UNIT_TESTS_ASSERT(!reader.GetPose(Timestamp(991), pose));
+
+    for (int i = 0; i < 100; ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(reader.GetPose(Timestamp(10 * i), pose));
+      RRLIB_UNIT_TESTS_ASSERT(IsEqual(Sample(i), pose, 1E-4));
+    }
+    RRLIB_UNIT_TESTS_ASSERT(reader.GetPose(Timestamp(345), pose));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(Interpolate(Sample(34), Sample(35), 0.5), pose, 1E-4));
+    RRLIB_UNIT_TESTS_ASSERT(reader.GetPose(Timestamp(698), pose));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(Interpolate(Sample(69), Sample(70), 0.8), pose, 1E-4));
+    std::remove(cFILE_NAME);
+  }
+
+  void Range()
+  {
+    WriteSamples();
+    tTrajectoryLogReader<tPose3D<>> reader(cFILE_NAME);
+    tTrajectoryLogReader<tPose3D<>>::tStampedPose samples[20];
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(16), reader.GetRange(Timestamp(65), Timestamp(220), samples, 20));
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(70) == samples[0].timestamp);
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(220) == samples[15].timestamp);
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(Sample(22), samples[15].pose, 1E-4));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), reader.GetRange(Timestamp(0), Timestamp(900), samples, 2));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), reader.GetRange(Timestamp(995), Timestamp(2000), samples, 20));
+    std::remove(cFILE_NAME);
+  }
+
+  void MissingIndex()
+  {
+    WriteSamples();
+    std::vector<char> data;
+    {
+      std::ifstream file(cFILE_NAME, std::ios::binary);
+      data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    // Simulate a writer that was not closed properly: no index and an incomplete last record
+    std::ofstream(cFILE_NAME, std::ios::binary | std::ios::trunc).write(data.data(), data.size() / 2);
+
+    tTrajectoryLogReader<tPose3D<>> reader(cFILE_NAME);
+    RRLIB_UNIT_TESTS_ASSERT(reader.IndexRecovered());
+    RRLIB_UNIT_TESTS_ASSERT(reader.Size() > 10 && reader.Size() < 100);
+    RRLIB_UNIT_TESTS_ASSERT(Timestamp(10 * (reader.Size() - 1)) == reader.NewestTimestamp());
+    tPose3D<> pose;
+    RRLIB_UNIT_TESTS_ASSERT(reader.GetPose(Timestamp(55), pose));
+    RRLIB_UNIT_TESTS_ASSERT(IsEqual(Interpolate(Sample(5), Sample(6), 0.5), pose, 1E-4));
+    RRLIB_UNIT_TESTS_ASSERT(!reader.GetPose(reader.NewestTimestamp() + std::chrono::milliseconds(1), pose));
+    std::remove(cFILE_NAME);
+  }
+
+  void InvalidFiles()
+  {
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryLogReader<tPose3D<>>("does_not_exist.rrtl"), std::runtime_error);
+
+    WriteSamples();
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryLogReader<tPose2D<>>(cFILE_NAME), std::runtime_error);
+
+    std::ofstream(cFILE_NAME, std::ios::binary | std::ios::trunc) << "no trajectory log";
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryLogReader<tPose3D<>>(cFILE_NAME), std::runtime_error);
+    std::remove(cFILE_NAME);
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestTrajectoryLog);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,234 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/tests/trajectory_store.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include "rrlib/util/tUnitTestSuite.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "rrlib/localization/tTrajectoryStore.h"
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+const char *cFILE_NAME = "test_trajectory_store.rrts";
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+class TestTrajectoryStore : public util::tUnitTestSuite
+{
+  RRLIB_UNIT_TESTS_BEGIN_SUITE(TestTrajectoryStore);
+  RRLIB_UNIT_TESTS_ADD_TEST(RoundTrip);
+  RRLIB_UNIT_TESTS_ADD_TEST(UncertainPoses);
+  RRLIB_UNIT_TESTS_ADD_TEST(Range);
+  RRLIB_UNIT_TESTS_ADD_TEST(InvalidFiles);
+  RRLIB_UNIT_TESTS_END_SUITE;
+
+private:
+
+  //! The time of the record with the given index in a recording at 100 Hz
+  static time::tTimestamp RecordTime(size_t index)
+  {
+    return time::tTimestamp() + std::chrono::milliseconds(10 * index);
+  }
+
+  //! A vehicle driving forward on a slightly wavy path while slowly turning
+  static tPose3D<> Record(size_t index)
+  {
+    return tPose3D<>(0.2 * index, 5 * std::sin(0.02 * index), 0, math::tAngleDeg(0), math::tAngleDeg(2), math::tAngleDeg(0.5 * index));
+  }
+
+  static void WriteRecords(size_t count)
+  {
+    tTrajectoryStoreWriter<tPose3D<>> writer(cFILE_NAME);
+    for (size_t i = 0; i < count; ++i)
+    {
+      writer.Append(RecordTime(i), Record(i));
+    }
+  }
+
+  void RoundTrip()
+  {
+    {
+      tTrajectoryStoreWriter<tPose3D<>> writer(cFILE_NAME);
+      for (size_t i = 0; i < 100; ++i)
+      {
+        RRLIB_UNIT_TESTS_ASSERT(writer.Append(RecordTime(i), Record(i)));
+      }
+      RRLIB_UNIT_TESTS_ASSERT(!writer.Append(RecordTime(50), Record(0)));
+      RRLIB_UNIT_TESTS_EQUALITY(size_t(100), writer.Size());
+    }
+
+    tTrajectoryStore<tPose3D<>> store(cFILE_NAME);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(100), store.Size());
+    size_t i = 0;
+    for (auto it = store.begin(); it != store.end(); ++it, ++i)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(RecordTime(i) == it.Timestamp());
+      RRLIB_UNIT_TESTS_ASSERT(Record(i) == *it);
+    }
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(100), i);
+    RRLIB_UNIT_TESTS_ASSERT(Record(42) == store[42]);
+    RRLIB_UNIT_TESTS_ASSERT(RecordTime(42) == store.Timestamp(42));
+    RRLIB_UNIT_TESTS_EQUALITY(Record(99).X().Value(), (store.end() - 1)->X().Value());
+
+
+    // an incomplete record of an interrupted writer is ignored
+    std::ofstream(cFILE_NAME, std::ios::binary | std::ios::app) << "incomplete";
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(100), tTrajectoryStore<tPose3D<>>(cFILE_NAME).Size());
+    std::remove(cFILE_NAME);
+  }
+
+  void UncertainPoses()
+  {
+    tUncertainPose3D<> pose(Record(3), tUncertainPose3D<>::tCovarianceMatrix<>());
+    for (size_t i = 0; i < 6; ++i)
+    {
+      pose.Covariance()[i][i] = 0.1 * (i + 1);
+    }
+    pose.Covariance()[0][5] = pose.Covariance()[5][0] = 0.01;
+    {
+      tTrajectoryStoreWriter<tUncertainPose3D<>> writer(cFILE_NAME);
+      writer.Append(RecordTime(0), pose);
+      pose.Covariance()[2][2] = 5;
+      writer.Append(RecordTime(1), pose);
+    }
+
+    tTrajectoryStore<tUncertainPose3D<>> store(cFILE_NAME);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(2), store.Size());
+    RRLIB_UNIT_TESTS_ASSERT(pose == store[1]);
+    for (size_t i = 0; i < 6; ++i)
+    {
+      for (size_t j = 0; j < 6; ++j)
+      {
+        RRLIB_UNIT_TESTS_EQUALITY(pose.Covariance()[i][j], store[1].Covariance()[i][j]);
+      }
+    }
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.3, store[0].Covariance()[2][2], 1E-12);
+    RRLIB_UNIT_TESTS_EQUALITY_DOUBLE(0.01, store[0].Covariance()[5][0], 1E-12);
+    std::remove(cFILE_NAME);
+  }
+
+  void Range()
+  {
+    WriteRecords(100);
+    tTrajectoryStore<tPose3D<>> store(cFILE_NAME);
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(0), store.LowerBound(RecordTime(0)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(36), store.LowerBound(RecordTime(35) + std::chrono::milliseconds(5)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(36), store.UpperBound(RecordTime(35) + std::chrono::milliseconds(5)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(37), store.UpperBound(RecordTime(36)));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(100), store.LowerBound(RecordTime(200)));
+
+    auto range = store.GetRange(RecordTime(6) + std::chrono::milliseconds(5), RecordTime(22));
+    RRLIB_UNIT_TESTS_EQUALITY(size_t(16), range.Size());
+    RRLIB_UNIT_TESTS_ASSERT(RecordTime(7) == range.begin().Timestamp());
+    RRLIB_UNIT_TESTS_ASSERT(Record(22) == *(range.end() - 1));
+    size_t i = 7;
+    for (const auto & pose : range)
+    {
+      RRLIB_UNIT_TESTS_ASSERT(Record(i++) == pose);
+    }
+    RRLIB_UNIT_TESTS_ASSERT(store.GetRange(RecordTime(99) + std::chrono::milliseconds(5), RecordTime(200)).Empty());
+    RRLIB_UNIT_TESTS_ASSERT(store.GetRange(RecordTime(50), RecordTime(40)).Empty());
+
+    // the iterators yield copies, so they are used like input iterators
+    auto farthest = range.begin();
+    for (auto it = range.begin(); it != range.end(); ++it)
+    {
+      if (it->X().Value() > farthest->X().Value())
+      {
+        farthest = it;
+      }
+    }
+    RRLIB_UNIT_TESTS_ASSERT(RecordTime(22) == farthest.Timestamp());
+    std::remove(cFILE_NAME);
+  }
+
+  void InvalidFiles()
+  {
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryStore<tPose3D<>>("does_not_exist.rrts"), std::runtime_error);
+
+    WriteRecords(10);
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryStore<tPose2D<>>(cFILE_NAME), std::runtime_error);
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryStore<tUncertainPose3D<>>(cFILE_NAME), std::runtime_error);
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryStore<tPose3D<float>>(cFILE_NAME), std::runtime_error);
+
+    // the same record layout with another element type
+    {
+      std::fstream file(cFILE_NAME, std::ios::binary | std::ios::in | std::ios::out);
+      file.seekp(7);
+      file.put(0);
+    }
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryStore<tPose3D<>>(cFILE_NAME), std::runtime_error);
+
+    std::ofstream(cFILE_NAME, std::ios::binary | std::ios::trunc) << "no trajectory store";
+    RRLIB_UNIT_TESTS_EXCEPTION(tTrajectoryStore<tPose3D<>>(cFILE_NAME), std::runtime_error);
+    std::remove(cFILE_NAME);
+  }
+};
+
+RRLIB_UNIT_TESTS_REGISTER_SUITE(TestTrajectoryStore);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
@@ -0,0 +1,315 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/text_conversion.cpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+#include "rrlib/localization/text_conversion.h"
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale.h>
+
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace usage
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+namespace text_conversion
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace
+{
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+
+template <typename TElement>
+std::errc ParseNumberToken(const char *&cursor, const char *last, TElement &value)
+{
+  // std::from_chars does not accept the leading plus that stream extraction does
+  const char *first = cursor;
+  if (first != last && *first == '+' && first + 1 != last && first[1] != '-')
+  {
+    ++first;
+  }
+  TElement result;
+  const std::from_chars_result conversion = std::from_chars(first, last, result);
+  if (conversion.ec != std::errc())
+  {
+    return conversion.ec;
+  }
+  cursor = conversion.ptr;
+  value = result;
+  return std::errc();
+}
+
+template <typename TElement>
+bool FormatNumberToken(char *&cursor, char *last, TElement value)
+{
+  const std::to_chars_result conversion = std::to_chars(cursor, last, value);
+  if (conversion.ec != std::errc())
+  {
+    return false;
+  }
+  cursor = conversion.ptr;
+  return true;
+}
+
+#else
+
+const size_t cMAX_NUMBER_LENGTH = 64;
+
+inline bool IsNumberCharacter(char c)
+{
+  // digits, signs, decimal point, exponent and the letters of inf, infinity and nan
+  return (c >= '0' && c <= '9') || c == '+' || c == '-' || c == '.' || std::strchr("eEiInNfFtTyYaA", c) != nullptr;
+}
+
+/*!
+ * strtod and printf follow LC_NUMERIC, which would expect and write a decimal comma
+ * in e.g. a German locale. All conversions therefore use the "C" locale explicitly.
+ * newlocale only fails if it runs out of memory, which leaves the global locale.
+ */
+inline locale_t CLocale()
+{
+  static const locale_t c_locale = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+  return c_locale;
+}
+
+inline float Convert(const char *text, char **end, float)
+{
+  const locale_t c_locale = CLocale();
+  return c_locale != static_cast<locale_t>(0) ? strtof_l(text, end, c_locale) : std::strtof(text, end);
+}
+
+inline double Convert(const char *text, char **end, double)
+{
+  const locale_t c_locale = CLocale();
+  return c_locale != static_cast<locale_t>(0) ? strtod_l(text, end, c_locale) : std::strtod(text, end);
+}
+
+template <typename TElement>
+std::errc ParseNumberToken(const char *&cursor, const char *last, TElement &value)
+{
+  // strtod needs a terminated string, so the number is copied to the stack
+  char token[cMAX_NUMBER_LENGTH];
+  size_t length = 0;
+  while (cursor + length != last && length + 1 < cMAX_NUMBER_LENGTH && IsNumberCharacter(cursor[length]))
+  {
+    token[length] = cursor[length];
+    ++length;
+  }
+  if (cursor + length != last && IsNumberCharacter(cursor[length]))
+  {
+    // the number is longer than the buffer, so converting the copy would only read a prefix
+    return std::errc::result_out_of_range;
+  }
+  token[length] = 0;
+
+  char *end = nullptr;
+  errno = 0;
+  const TElement result = Convert(token, &end, TElement());
+  if (end == token)
+  {
+    return std::errc::invalid_argument;
+  }
+  if (errno == ERANGE)
+  {
+    return std::errc::result_out_of_range;
+  }
+  cursor += end - token;
+  value = result;
+  return std::errc();
+}
+
+template <typename TElement>
+bool FormatNumberToken(char *&cursor, char *last, TElement value)
+{
+  // Try the short representations first and take the first one that reads back exactly
+  const int digits = std::numeric_limits<TElement>::digits10;
+  const int max_digits = std::numeric_limits<TElement>::max_digits10;
+  char token[cMAX_NUMBER_LENGTH];
+  int length = 0;
+  const locale_t c_locale = CLocale();
+  const locale_t previous_locale = c_locale != static_cast<locale_t>(0) ? uselocale(c_locale) : static_cast<locale_t>(0);
+  for (int precision = digits; precision <= max_digits; ++precision)
+  {
+    length = std::snprintf(token, sizeof(token), "%.*g", precision, static_cast<double>(value));
+    if (Convert(token, nullptr, TElement()) == value)
+    {
+      break;
+    }
+  }
+  if (c_locale != static_cast<locale_t>(0))
+  {
+    uselocale(previous_locale);
+  }
+  if (length < 0 || static_cast<size_t>(length) > static_cast<size_t>(last - cursor))
+  {
+    return false;
+  }
+  std::memcpy(cursor, token, length);
+  cursor += length;
+  return true;
+}
+
+#endif
+
+inline void SkipWhitespace(const char *&cursor, const char *last)
+{
+  while (cursor != last && (*cursor == ' ' || *cursor == '\t' || *cursor == '\n' || *cursor == '\r' || *cursor == '\f' || *cursor == '\v'))
+  {
+    ++cursor;
+  }
+}
+
+template <typename TElement>
+std::errc ParseNumberAfterWhitespace(const char *&cursor, const char *last, TElement &value)
+{
+  const char *first = cursor;
+  SkipWhitespace(cursor, last);
+  const std::errc result = ParseNumberToken(cursor, last, value);
+  if (result != std::errc())
+  {
+    cursor = first;
+  }
+  return result;
+}
+
+}
+
+//----------------------------------------------------------------------
+// ParseCharacter
+//----------------------------------------------------------------------
+bool ParseCharacter(const char *&cursor, const char *last, char expected)
+{
+  SkipWhitespace(cursor, last);
+  if (cursor == last || *cursor != expected)
+  {
+    return false;
+  }
+  ++cursor;
+  return true;
+}
+
+//----------------------------------------------------------------------
+// ParseNumber
+//----------------------------------------------------------------------
+std::errc ParseNumber(const char *&cursor, const char *last, float &value)
+{
+  return ParseNumberAfterWhitespace(cursor, last, value);
+}
+
+std::errc ParseNumber(const char *&cursor, const char *last, double &value)
+{
+  return ParseNumberAfterWhitespace(cursor, last, value);
+}
+
+//----------------------------------------------------------------------
+// SkipDegreeSign
+//----------------------------------------------------------------------
+void SkipDegreeSign(const char *&cursor, const char *last)
+{
+  // The degree sign is U+00B0, i.e. 0xC2 0xB0 in UTF-8
+  if (last - cursor >= 2 && static_cast<unsigned char>(cursor[0]) == 0xC2 && static_cast<unsigned char>(cursor[1]) == 0xB0)
+  {
+    cursor += 2;
+  }
+}
+
+//----------------------------------------------------------------------
+// FormatText
+//----------------------------------------------------------------------
+bool FormatText(char *&cursor, char *last, const char *text)
+{
+  const size_t length = std::strlen(text);
+  if (length > static_cast<size_t>(last - cursor))
+  {
+    return false;
+  }
+  std::memcpy(cursor, text, length);
+  cursor += length;
+  return true;
+}
+
+//----------------------------------------------------------------------
+// FormatNumber
+//----------------------------------------------------------------------
+bool FormatNumber(char *&cursor, char *last, float value)
+{
+  return FormatNumberToken(cursor, last, value);
+}
+
+bool FormatNumber(char *&cursor, char *last, double value)
+{
+  return FormatNumberToken(cursor, last, value);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+}
@@ -0,0 +1,177 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/text_conversion.h
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ * \brief   Fast conversion of orientations, poses and covariances from and to text
+ *
+ * The functions in this file read and write the same text representation
+ * as the stream operators, e.g. "(1, 2, 3, 4°, 5°, 6°)" for a 3D pose,
+ * followed by "((a, b, ...), ...)" for the covariance of uncertain poses.
+ * They work on character ranges like std::from_chars and std::to_chars and
+ * neither use iostreams nor allocate memory, which makes them suitable
+ * for bulk ingestion of recorded trajectories and for real-time code.
+ *
+ * Numbers are converted with std::from_chars and std::to_chars if the
+ * standard library provides them for floating point values, otherwise
+ * with strtod and snprintf. Numbers are written with the shortest
+ * representation that reads back to the same value, so in contrast to
+ * the stream operators no precision is lost.
+ *
+ * As with std::from_chars, the target is only modified on success. On
+ * failure the returned pointer is first for parsing and last for formatting.
+ *
+ */
+//----------------------------------------------------------------------
+#ifndef __rrlib__localization__text_conversion_h__
+#define __rrlib__localization__text_conversion_h__
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <cstddef>
+#include <system_error>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+#include "rrlib/localization/tOrientation.h"
+#include "rrlib/localization/tPose.h"
+#include "rrlib/localization/tUncertainPose.h"
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//! The result of FromChars with the same meaning as std::from_chars_result
+struct tFromCharsResult
+{
+  const char *ptr;
+  std::errc ec;
+};
+
+//! The result of ToChars with the same meaning as std::to_chars_result
+struct tToCharsResult
+{
+  char *ptr;
+  std::errc ec;
+};
+
+namespace text_conversion
+{
+
+//! Skip whitespace and consume expected
+/*! \returns Whether the next non-whitespace character was expected
+ */
+bool ParseCharacter(const char *&cursor, const char *last, char expected);
+
+//! Skip whitespace and parse a number
+/*! \returns std::errc() on success, otherwise cursor is left where it was,
+ *           i.e. also in front of the skipped whitespace
+ */
+std::errc ParseNumber(const char *&cursor, const char *last, float &value);
+std::errc ParseNumber(const char *&cursor, const char *last, double &value);
+
+//! Skip the degree sign after an angle if present
+void SkipDegreeSign(const char *&cursor, const char *last);
+
+//! Append text without its terminating zero
+/*! \returns False if the text does not fit into [cursor, last)
+ */
+bool FormatText(char *&cursor, char *last, const char *text);
+
+//! Append the shortest representation of value that reads back to the same value
+/*! \returns False if the number does not fit into [cursor, last)
+ */
+bool FormatNumber(char *&cursor, char *last, float value);
+bool FormatNumber(char *&cursor, char *last, double value);
+
+}
+
+//----------------------------------------------------------------------
+// Function declarations
+//----------------------------------------------------------------------
+
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tOrientation<2, TElement, TSIUnit, TAutoWrapPolicy> &orientation);
+
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tOrientation<3, TElement, TSIUnit, TAutoWrapPolicy> &orientation);
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose);
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose);
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose);
+
+//! Read the covariance of a 2D pose
+template <typename TElement>
+tFromCharsResult FromChars(const char *first, const char *last, math::tMatrix<3, 3, TElement> &covariance);
+
+//! Read the covariance of a 3D pose
+template <typename TElement>
+tFromCharsResult FromChars(const char *first, const char *last, math::tMatrix<6, 6, TElement> &covariance);
+
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tOrientation<2, TElement, TSIUnit, TAutoWrapPolicy> &orientation);
+
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tOrientation<3, TElement, TSIUnit, TAutoWrapPolicy> &orientation);
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose);
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose);
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose);
+
+template <typename TElement>
+tToCharsResult ToChars(char *first, char *last, const math::tMatrix<3, 3, TElement> &covariance);
+
+template <typename TElement>
+tToCharsResult ToChars(char *first, char *last, const math::tMatrix<6, 6, TElement> &covariance);
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}
+
+#include "rrlib/localization/text_conversion.hpp"
+
+#endif
@@ -0,0 +1,348 @@
+//
+// You received this file as part of RRLib
+// Robotics Research Library
+//
+// Copyright (C) Finroc GbR (finroc.org)
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program; if not, write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//----------------------------------------------------------------------
+/*!\file    rrlib/localization/text_conversion.hpp
+ *
+ * \author  Tobias Föhst
+ *
+ * \date    2026-10-17
+ *
+ */
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// External includes (system with <>, local with "")
+//----------------------------------------------------------------------
+#include <type_traits>
+
+//----------------------------------------------------------------------
+// Internal includes with ""
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Debugging
+//----------------------------------------------------------------------
+#include <cassert>
+
+//----------------------------------------------------------------------
+// Namespace declaration
+//----------------------------------------------------------------------
+namespace rrlib
+{
+namespace localization
+{
+
+//----------------------------------------------------------------------
+// Forward declarations / typedefs / enums
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Const values
+//----------------------------------------------------------------------
+
+//----------------------------------------------------------------------
+// Implementation
+//----------------------------------------------------------------------
+
+namespace text_conversion
+{
+
+//! Parse "(v_0, v_1, ..., v_count-1)" where the values starting at first_angle may carry a degree sign
+template <typename TElement>
+std::errc ParseTuple(const char *&cursor, const char *last, TElement *values, size_t count, size_t first_angle)
+{
+  if (!ParseCharacter(cursor, last, '('))
+  {
+    return std::errc::invalid_argument;
+  }
+  for (size_t i = 0; i < count; ++i)
+  {
+    if (i > 0 && !ParseCharacter(cursor, last, ','))
+    {
+      return std::errc::invalid_argument;
+    }
+    const std::errc error = ParseNumber(cursor, last, values[i]);
+    if (error != std::errc())
+    {
+      return error;
+    }
+    if (i >= first_angle)
+    {
+      SkipDegreeSign(cursor, last);
+    }
+  }
+  return ParseCharacter(cursor, last, ')') ? std::errc() : std::errc::invalid_argument;
+}
+
+//! Write "(v_0, v_1, ..., v_count-1)" where the values starting at first_angle get a degree sign
+template <typename TElement>
+bool FormatTuple(char *&cursor, char *last, const TElement *values, size_t count, size_t first_angle)
+{
+  if (!FormatText(cursor, last, "("))
+  {
+    return false;
+  }
+  for (size_t i = 0; i < count; ++i)
+  {
+    if ((i > 0 && !FormatText(cursor, last, ", ")) || !FormatNumber(cursor, last, values[i]) || (i >= first_angle && !FormatText(cursor, last, "°")))
+    {
+      return false;
+    }
+  }
+  return FormatText(cursor, last, ")");
+}
+
+template <size_t Tsize, typename TMatrix>
+tFromCharsResult ParseMatrix(const char *first, const char *last, TMatrix &matrix)
+{
+  typedef typename std::remove_cv<typename std::remove_reference<decltype(matrix[0][0])>::type>::type tElement;
+  const char *cursor = first;
+  tElement values[Tsize][Tsize];
+  if (!ParseCharacter(cursor, last, '('))
+  {
+    return tFromCharsResult {first, std::errc::invalid_argument};
+  }
+  for (size_t row = 0; row < Tsize; ++row)
+  {
+    if (row > 0 && !ParseCharacter(cursor, last, ','))
+    {
+      return tFromCharsResult {first, std::errc::invalid_argument};
+    }
+    const std::errc error = ParseTuple(cursor, last, values[row], Tsize, Tsize);
+    if (error != std::errc())
+    {
+      return tFromCharsResult {first, error};
+    }
+  }
+  if (!ParseCharacter(cursor, last, ')'))
+  {
+    return tFromCharsResult {first, std::errc::invalid_argument};
+  }
+  for (size_t row = 0; row < Tsize; ++row)
+  {
+    for (size_t column = 0; column < Tsize; ++column)
+    {
+      matrix[row][column] = values[row][column];
+    }
+  }
+  return tFromCharsResult {cursor, std::errc()};
+}
+
+template <size_t Tsize, typename TMatrix>
+tToCharsResult FormatMatrix(char *first, char *last, const TMatrix &matrix)
+{
+  typedef typename std::remove_cv<typename std::remove_reference<decltype(matrix[0][0])>::type>::type tElement;
+  char *cursor = first;
+  bool success = FormatText(cursor, last, "(");
+  for (size_t row = 0; success && row < Tsize; ++row)
+  {
+    tElement values[Tsize];
+    for (size_t column = 0; column < Tsize; ++column)
+    {
+      values[column] = matrix[row][column];
+    }
+    success = (row == 0 || FormatText(cursor, last, ", ")) && FormatTuple(cursor, last, values, Tsize, Tsize);
+  }
+  if (!success || !FormatText(cursor, last, ")"))
+  {
+    return tToCharsResult {last, std::errc::value_too_large};
+  }
+  return tToCharsResult {cursor, std::errc()};
+}
+
+}
+
+//----------------------------------------------------------------------
+// FromChars
+//----------------------------------------------------------------------
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tOrientation<2, TElement, TSIUnit, TAutoWrapPolicy> &orientation)
+{
+  const char *cursor = first;
+  TElement yaw;
+  const std::errc error = text_conversion::ParseNumber(cursor, last, yaw);
+  if (error != std::errc())
+  {
+    return tFromCharsResult {first, error};
+  }
+  text_conversion::SkipDegreeSign(cursor, last);
+  orientation.Set(math::tAngle<TElement, math::angle::Degree, math::angle::Signed>(yaw));
+  return tFromCharsResult {cursor, std::errc()};
+}
+
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tOrientation<3, TElement, TSIUnit, TAutoWrapPolicy> &orientation)
+{
+  typedef math::tAngle<TElement, math::angle::Degree, math::angle::Signed> tDegreeSigned;
+  const char *cursor = first;
+  TElement values[3];
+  const std::errc error = text_conversion::ParseTuple(cursor, last, values, 3, 0);
+  if (error != std::errc())
+  {
+    return tFromCharsResult {first, error};
+  }
+  orientation.Set(tDegreeSigned(values[0]), tDegreeSigned(values[1]), tDegreeSigned(values[2]));
+  return tFromCharsResult {cursor, std::errc()};
+}
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose)
+{
+  typedef math::tAngle<TElement, math::angle::Degree, TAutoWrapPolicy> tDegree;
+  const char *cursor = first;
+  TElement values[3];
+  const std::errc error = text_conversion::ParseTuple(cursor, last, values, 3, 2);
+  if (error != std::errc())
+  {
+    return tFromCharsResult {first, error};
+  }
+  pose.Set(values[0], values[1], tDegree(values[2]));
+  return tFromCharsResult {cursor, std::errc()};
+}
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose)
+{
+  typedef math::tAngle<TElement, math::angle::Degree, TAutoWrapPolicy> tDegree;
+  const char *cursor = first;
+  TElement values[6];
+  const std::errc error = text_conversion::ParseTuple(cursor, last, values, 6, 3);
+  if (error != std::errc())
+  {
+    return tFromCharsResult {first, error};
+  }
+  pose.Set(values[0], values[1], values[2], tDegree(values[3]), tDegree(values[4]), tDegree(values[5]));
+  return tFromCharsResult {cursor, std::errc()};
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tFromCharsResult FromChars(const char *first, const char *last, tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose)
+{
+  tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> mean;
+  auto covariance = pose.Covariance();
+  tFromCharsResult result = FromChars(first, last, mean);
+  if (result.ec == std::errc())
+  {
+    result = FromChars(result.ptr, last, covariance);
+  }
+  if (result.ec != std::errc())
+  {
+    return tFromCharsResult {first, result.ec};
+  }
+  static_cast<tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &>(pose) = mean;
+  pose.Covariance() = covariance;
+  return result;
+}
+
+template <typename TElement>
+tFromCharsResult FromChars(const char *first, const char *last, math::tMatrix<3, 3, TElement> &covariance)
+{
+  return text_conversion::ParseMatrix<3>(first, last, covariance);
+}
+
+template <typename TElement>
+tFromCharsResult FromChars(const char *first, const char *last, math::tMatrix<6, 6, TElement> &covariance)
+{
+  return text_conversion::ParseMatrix<6>(first, last, covariance);
+}
+
+//----------------------------------------------------------------------
+// ToChars
+//----------------------------------------------------------------------
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tOrientation<2, TElement, TSIUnit, TAutoWrapPolicy> &orientation)
+{
+  char *cursor = first;
+  const TElement yaw = math::tAngle<TElement, math::angle::Degree, math::angle::Signed>(orientation.Yaw().Value()).Value();
+  if (!text_conversion::FormatNumber(cursor, last, yaw) || !text_conversion::FormatText(cursor, last, "°"))
+  {
+    return tToCharsResult {last, std::errc::value_too_large};
+  }
+  return tToCharsResult {cursor, std::errc()};
+}
+
+template <typename TElement, typename TSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tOrientation<3, TElement, TSIUnit, TAutoWrapPolicy> &orientation)
+{
+  typedef math::tAngle<TElement, math::angle::Degree, math::angle::Signed> tDegreeSigned;
+  char *cursor = first;
+  const TElement values[3] = { tDegreeSigned(orientation.Roll().Value()).Value(), tDegreeSigned(orientation.Pitch().Value()).Value(), tDegreeSigned(orientation.Yaw().Value()).Value() };
+  if (!text_conversion::FormatTuple(cursor, last, values, 3, 0))
+  {
+    return tToCharsResult {last, std::errc::value_too_large};
+  }
+  return tToCharsResult {cursor, std::errc()};
+}
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tPose<2, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose)
+{
+  typedef math::tAngle<TElement, math::angle::Degree, TAutoWrapPolicy> tDegree;
+  char *cursor = first;
+  const TElement values[3] = { pose.X().Value(), pose.Y().Value(), tDegree(pose.Yaw().Value()).Value() };
+  if (!text_conversion::FormatTuple(cursor, last, values, 3, 2))
+  {
+    return tToCharsResult {last, std::errc::value_too_large};
+  }
+  return tToCharsResult {cursor, std::errc()};
+}
+
+template <typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tPose<3, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose)
+{
+  typedef math::tAngle<TElement, math::angle::Degree, TAutoWrapPolicy> tDegree;
+  char *cursor = first;
+  const TElement values[6] = { pose.X().Value(), pose.Y().Value(), pose.Z().Value(), tDegree(pose.Roll().Value()).Value(), tDegree(pose.Pitch().Value()).Value(), tDegree(pose.Yaw().Value()).Value() };
+  if (!text_conversion::FormatTuple(cursor, last, values, 6, 3))
+  {
+    return tToCharsResult {last, std::errc::value_too_large};
+  }
+  return tToCharsResult {cursor, std::errc()};
+}
+
+template <unsigned int Tdimension, typename TElement, typename TPositionSIUnit, typename TOrientationSIUnit, typename TAutoWrapPolicy>
+tToCharsResult ToChars(char *first, char *last, const tUncertainPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &pose)
+{
+  const tToCharsResult result = ToChars(first, last, static_cast<const tPose<Tdimension, TElement, TPositionSIUnit, TOrientationSIUnit, TAutoWrapPolicy> &>(pose));
+  if (result.ec != std::errc())
+  {
+    return result;
+  }
+  return ToChars(result.ptr, last, pose.Covariance());
+}
+
+template <typename TElement>
+tToCharsResult ToChars(char *first, char *last, const math::tMatrix<3, 3, TElement> &covariance)
+{
+  return text_conversion::FormatMatrix<3>(first, last, covariance);
+}
+
+template <typename TElement>
+tToCharsResult ToChars(char *first, char *last, const math::tMatrix<6, 6, TElement> &covariance)
+{
+  return text_conversion::FormatMatrix<6>(first, last, covariance);
+}
+
+//----------------------------------------------------------------------
+// End of namespace declaration
+//----------------------------------------------------------------------
+}
+}